@@ -0,0 +1,400 @@
+/**
+ * \file bitGrid.c
+ * \brief The grids of bits of the walkable tiles
+ * \version 0.1
+ * \date 17/10/2026
+ *
+ * Module that packs the tiles a path can go through (EMPTY and VISITED) in 64 bits words, a row after the other.
+ * A flood of the field then moves a whole row of 64 tiles at once : the tiles reached along a row are filled
+ * with shifts of the words, and the rows are swept up and down until nothing changes.
+ * It is used to know which tiles can be reached from a position before searching any path.
+ *
+ */
+
+//Header files containing the prototypes
+#include "bitGrid.h"
+
+/**
+ * \fn BitGrid* initBitGrid(int width, int height)
+ * \brief function that creates a grid of bits without any walkable tile for the fields of the given dimension
+ *
+ * \param width, height : the dimension of the fields
+ * \return BitGrid*
+ */
+BitGrid* initBitGrid(int width, int height)
+{
+    BitGrid* grid = malloc(sizeof(BitGrid));
+    grid->width = width;
+    grid->height = height;
+    grid->nbWordsRow = (width + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    int nbWords = grid->nbWordsRow * height;
+    grid->walkable = calloc(nbWords, sizeof(uint64_t));
+    grid->reached = calloc(nbWords, sizeof(uint64_t));
+    grid->frontier = calloc(nbWords, sizeof(uint64_t));
+    grid->next = calloc(nbWords, sizeof(uint64_t));
+    return grid;
+}
+
+/**
+ * \fn void destructBitGrid(BitGrid** grid)
+ * \brief function that free a grid of bits out of memory
+ *
+ * \param grid : a double pointer on the grid
+ * \return void
+ */
+void destructBitGrid(BitGrid** grid)
+{
+    if(grid != NULL)
+    {
+        if(*grid != NULL)
+        {
+            free((*grid)->walkable);
+            free((*grid)->reached);
+            free((*grid)->frontier);
+            free((*grid)->next);
+            free(*grid);
+            *grid = NULL;
+        }
+    }
+}
+
+/**
+ * \fn BitGrid* getSharedBitGrid(int width, int height)
+ * \brief function that returns the grid of bits shared by the fields of the given dimension
+ * The grid is only allocated again when the dimension changes. It must only be used by one thread
+ *
+ * \param width, height : the dimension of the fields
+ * \return BitGrid*
+ */
+BitGrid* getSharedBitGrid(int width, int height)
+{
+    static BitGrid* sharedGrid = NULL;
+    if(sharedGrid == NULL || sharedGrid->width != width || sharedGrid->height != height)
+    {
+        destructBitGrid(&sharedGrid);
+        sharedGrid = initBitGrid(width, height);
+    }
+    return sharedGrid;
+}
+
+/**
+ * \fn void setFieldBitGrid(BitGrid* grid, const Field* theField)
+ * \brief function that packs the tiles of a field a path can go through (EMPTY and VISITED) in a grid of bits
+ *
+ * \param grid : the grid, of the dimension of the field
+ * \param theField : the field
+ * \return void
+ */
+void setFieldBitGrid(BitGrid* grid, const Field* theField)
+{
+    int y;
+    for(y = 0; y < grid->height; y++)
+    {
+        const fieldTile* tiles = theField->data + y * theField->stride;
+        uint64_t* row = grid->walkable + y * grid->nbWordsRow;
+        int word;
+        for(word = 0; word < grid->nbWordsRow; word++)
+        {
+            int xFirst = word * BITS_PER_WORD;
+            int xLast = xFirst + BITS_PER_WORD;
+            if(xLast > grid->width)
+            {
+                xLast = grid->width;
+            }
+            uint64_t bits = 0;
+            int x;
+            for(x = xFirst; x < xLast; x++)
+            {
+                if(tiles[x] == EMPTY || tiles[x] == VISITED)
+                {
+                    bits |= (uint64_t)1 << (x - xFirst);
+                }
+            }
+            row[word] = bits;
+        }
+    }
+}
+
+/**
+ * \fn static bool getBit(const uint64_t* bits, const BitGrid* grid, int x, int y)
+ * \brief function that returns the bit of a tile in one of the layers of a grid of bits
+ *
+ * \param bits : the layer of the grid
+ * \param grid : the grid
+ * \param x, y : the coordinate of the tile, which can be outside of the field
+ * \return bool
+ */
+static bool getBit(const uint64_t* bits, const BitGrid* grid, int x, int y)
+{
+    if(x < 0 || x >= grid->width || y < 0 || y >= grid->height)
+    {
+        return false;
+    }
+    return (bits[y * grid->nbWordsRow + x / BITS_PER_WORD] >> (x % BITS_PER_WORD)) & 1;
+}
+
+/**
+ * \fn bool isWalkableBitGrid(const BitGrid* grid, int x, int y)
+ * \brief function which check if a path can go through a tile of a grid of bits
+ *
+ * \param grid : the grid
+ * \param x, y : the coordinate to check, which can be outside of the field
+ * \return bool
+ */
+bool isWalkableBitGrid(const BitGrid* grid, int x, int y)
+{
+    return getBit(grid->walkable, grid, x, y);
+}
+
+/**
+ * \fn bool isReachedBitGrid(const BitGrid* grid, int x, int y)
+ * \brief function which check if a tile has been reached by the last flood of a grid of bits
+ *
+ * \param grid : the grid
+ * \param x, y : the coordinate to check, which can be outside of the field
+ * \return bool
+ */
+bool isReachedBitGrid(const BitGrid* grid, int x, int y)
+{
+    return getBit(grid->reached, grid, x, y);
+}
+
+/**
+ * \fn static uint64_t fillHigherBits(uint64_t seeds, uint64_t walkable)
+ * \brief function that spreads some bits of a word towards the higher bits, as long as they go through walkable bits
+ * (occluded fill of Kogge-Stone, in 6 steps for 64 bits)
+ *
+ * \param seeds : the bits to spread, which don't have to be walkable
+ * \param walkable : the bits they can go through
+ * \return uint64_t : the seeds and the bits they reached
+ */
+static uint64_t fillHigherBits(uint64_t seeds, uint64_t walkable)
+{
+    seeds |= walkable & (seeds << 1);
+    walkable &= walkable << 1;
+    seeds |= walkable & (seeds << 2);
+    walkable &= walkable << 2;
+    seeds |= walkable & (seeds << 4);
+    walkable &= walkable << 4;
+    seeds |= walkable & (seeds << 8);
+    walkable &= walkable << 8;
+    seeds |= walkable & (seeds << 16);
+    walkable &= walkable << 16;
+    seeds |= walkable & (seeds << 32);
+    return seeds;
+}
+
+/**
+ * \fn static uint64_t fillLowerBits(uint64_t seeds, uint64_t walkable)
+ * \brief function that spreads some bits of a word towards the lower bits, as long as they go through walkable bits
+ *
+ * \param seeds : the bits to spread, which don't have to be walkable
+ * \param walkable : the bits they can go through
+ * \return uint64_t : the seeds and the bits they reached
+ */
+static uint64_t fillLowerBits(uint64_t seeds, uint64_t walkable)
+{
+    seeds |= walkable & (seeds >> 1);
+    walkable &= walkable >> 1;
+    seeds |= walkable & (seeds >> 2);
+    walkable &= walkable >> 2;
+    seeds |= walkable & (seeds >> 4);
+    walkable &= walkable >> 4;
+    seeds |= walkable & (seeds >> 8);
+    walkable &= walkable >> 8;
+    seeds |= walkable & (seeds >> 16);
+    walkable &= walkable >> 16;
+    seeds |= walkable & (seeds >> 32);
+    return seeds;
+}
+
+/**
+ * \fn static void fillRow(uint64_t* row, const uint64_t* walkable, int nbWords)
+ * \brief function that spreads the reached tiles of a row along the walkable tiles of the row, to the right and then to the left
+ *
+ * \param row : the reached tiles of the row
+ * \param walkable : the walkable tiles of the row
+ * \param nbWords : the number of words of the row
+ * \return void
+ */
+static void fillRow(uint64_t* row, const uint64_t* walkable, int nbWords)
+{
+    uint64_t carry = 0;
+    int word;
+    for(word = 0; word < nbWords; word++)
+    {
+        //The last tile of the previous word reaches the first tile of this one
+        row[word] = fillHigherBits(row[word] | (carry & walkable[word]), walkable[word]);
+        carry = row[word] >> (BITS_PER_WORD - 1);
+    }
+    carry = 0;
+    for(word = nbWords - 1; word >= 0; word--)
+    {
+        row[word] = fillLowerBits(row[word] | (carry & walkable[word]), walkable[word]);
+        carry = row[word] << (BITS_PER_WORD - 1);
+    }
+}
+
+/**
+ * \fn static bool spreadRow(BitGrid* grid, int y)
+ * \brief function that adds to the reached tiles of a row the walkable tiles below and above reached tiles,
+ * and spreads them along the row
+ *
+ * \param grid : the grid
+ * \param y : the row
+ * \return bool : whether new tiles of the row have been reached
+ */
+static bool spreadRow(BitGrid* grid, int y)
+{
+    uint64_t* row = grid->reached + y * grid->nbWordsRow;
+    const uint64_t* walkable = grid->walkable + y * grid->nbWordsRow;
+    const uint64_t* above = NULL;
+    const uint64_t* below = NULL;
+    if(y > 0)
+    {
+        above = row - grid->nbWordsRow;
+    }
+    if(y < grid->height - 1)
+    {
+        below = row + grid->nbWordsRow;
+    }
+    bool isChanged = false;
+    int word;
+    for(word = 0; word < grid->nbWordsRow; word++)
+    {
+        uint64_t neighbors = 0;
+        if(above != NULL)
+        {
+            neighbors |= above[word];
+        }
+        if(below != NULL)
+        {
+            neighbors |= below[word];
+        }
+        uint64_t added = neighbors & walkable[word] & ~row[word];
+        if(added != 0)
+        {
+            row[word] |= added;
+            isChanged = true;
+        }
+    }
+    if(isChanged)
+    {
+        fillRow(row, walkable, grid->nbWordsRow);
+    }
+    return isChanged;
+}
+
+/**
+ * \fn void floodBitGrid(BitGrid* grid, int x, int y)
+ * \brief function that finds all the tiles which can be reached from a position by going through the walkable tiles.
+ * Like the A* algorithme, the position itself can be a wall
+ *
+ * \param grid : the grid, whose walkable tiles have been set
+ * \param x, y : the coordinate of the position, inside the field
+ * \return void
+ */
+void floodBitGrid(BitGrid* grid, int x, int y)
+{
+    memset(grid->reached, 0, sizeof(uint64_t) * grid->nbWordsRow * grid->height);
+    uint64_t* startRow = grid->reached + y * grid->nbWordsRow;
+    startRow[x / BITS_PER_WORD] = (uint64_t)1 << (x % BITS_PER_WORD);
+    fillRow(startRow, grid->walkable + y * grid->nbWordsRow, grid->nbWordsRow);
+
+    //We sweep the rows downward and then upward until no row changes,
+    //a sweep follows all the paths which only go down (or up) and along the rows
+    bool isChanged = true;
+    while(isChanged)
+    {
+        isChanged = false;
+        int row;
+        for(row = 0; row < grid->height; row++)
+        {
+            if(spreadRow(grid, row))
+            {
+                isChanged = true;
+            }
+        }
+        for(row = grid->height - 1; row >= 0; row--)
+        {
+            if(spreadRow(grid, row))
+            {
+                isChanged = true;
+            }
+        }
+    }
+}
+
+/**
+ * \fn int getDistanceBitGrid(BitGrid* grid, int xStart, int yStart, int xEnd, int yEnd)
+ * \brief function that returns the number of steps of a shortest path between two positions,
+ * by moving the frontier of a breadth first search one step at a time on whole rows.
+ * The tiles reached by the search are left in the reached tiles of the grid
+ *
+ * \param grid : the grid, whose walkable tiles have been set
+ * \param xStart, yStart : the coordinate of the start, inside the field, which can be a wall
+ * \param xEnd, yEnd : the coordinate of the end
+ * \return int : the number of steps, -1 if the end can't be reached
+ */
+int getDistanceBitGrid(BitGrid* grid, int xStart, int yStart, int xEnd, int yEnd)
+{
+    int nbWords = grid->nbWordsRow * grid->height;
+    memset(grid->reached, 0, sizeof(uint64_t) * nbWords);
+    memset(grid->frontier, 0, sizeof(uint64_t) * nbWords);
+    grid->reached[yStart * grid->nbWordsRow + xStart / BITS_PER_WORD] = (uint64_t)1 << (xStart % BITS_PER_WORD);
+    grid->frontier[yStart * grid->nbWordsRow + xStart / BITS_PER_WORD] = (uint64_t)1 << (xStart % BITS_PER_WORD);
+
+    int distance = 0;
+    bool isEmpty = false;
+    while(!isEmpty)
+    {
+        if(getBit(grid->frontier, grid, xEnd, yEnd))
+        {
+            return distance;
+        }
+        //The next frontier is made of the walkable tiles next to the frontier which haven't been reached yet
+        isEmpty = true;
+        int y;
+        for(y = 0; y < grid->height; y++)
+        {
+            const uint64_t* row = grid->frontier + y * grid->nbWordsRow;
+            int word;
+            for(word = 0; word < grid->nbWordsRow; word++)
+            {
+                uint64_t neighbors = (row[word] << 1) | (row[word] >> 1);
+                if(word > 0)
+                {
+                    neighbors |= row[word - 1] >> (BITS_PER_WORD - 1);
+                }
+                if(word < grid->nbWordsRow - 1)
+                {
+                    neighbors |= row[word + 1] << (BITS_PER_WORD - 1);
+                }
+                if(y > 0)
+                {
+                    neighbors |= row[word - grid->nbWordsRow];
+                }
+                if(y < grid->height - 1)
+                {
+                    neighbors |= row[word + grid->nbWordsRow];
+                }
+                int index = y * grid->nbWordsRow + word;
+                grid->next[index] = neighbors & grid->walkable[index] & ~grid->reached[index];
+                if(grid->next[index] != 0)
+                {
+                    isEmpty = false;
+                }
+            }
+        }
+        int index;
+        for(index = 0; index < nbWords; index++)
+        {
+            grid->reached[index] |= grid->next[index];
+        }
+        uint64_t* temp = grid->frontier;
+        grid->frontier = grid->next;
+        grid->next = temp;
+        distance++;
+    }
+    return -1;
+}
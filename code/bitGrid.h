@@ -0,0 +1,121 @@
+/**
+ * \file bitGrid.h
+ * \brief Prototypes of the grids of bits of the walkable tiles
+ * \version 0.1
+ * \date 17/10/2026
+ *
+ * Module that packs the tiles a path can go through (EMPTY and VISITED) in 64 bits words, a row after the other.
+ * A flood of the field then moves a whole row of 64 tiles at once : the tiles reached along a row are filled
+ * with shifts of the words, and the rows are swept up and down until nothing changes.
+ * It is used to know which tiles can be reached from a position before searching any path.
+ *
+ */
+
+#ifndef H_BITGRID
+    #define H_BITGRID
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "prototype.h"
+
+//The number of tiles packed in a word of a grid of bits
+#define BITS_PER_WORD (64)
+
+//Structure of a grid of bits : the bit x % 64 of the word y * nbWordsRow + x / 64 is the tile (x, y).
+//The bits after the end of a row are always 0
+typedef struct BitGrid
+{
+    int width;
+    int height;
+    int nbWordsRow; //The number of words of a row
+    uint64_t* walkable; //Whether a path can go through each tile of the field
+    uint64_t* reached; //The tiles reached by the last flood
+    uint64_t* frontier; //The tiles reached at the last step of a search of the distance
+    uint64_t* next; //The tiles reached at the next step of a search of the distance
+}BitGrid;
+
+/**
+ * \fn BitGrid* initBitGrid(int width, int height)
+ * \brief function that creates a grid of bits without any walkable tile for the fields of the given dimension
+ *
+ * \param width, height : the dimension of the fields
+ * \return BitGrid*
+ */
+BitGrid* initBitGrid(int width, int height);
+
+/**
+ * \fn void destructBitGrid(BitGrid** grid)
+ * \brief function that free a grid of bits out of memory
+ *
+ * \param grid : a double pointer on the grid
+ * \return void
+ */
+void destructBitGrid(BitGrid** grid);
+
+/**
+ * \fn BitGrid* getSharedBitGrid(int width, int height)
+ * \brief function that returns the grid of bits shared by the fields of the given dimension
+ * The grid is only allocated again when the dimension changes. It must only be used by one thread
+ *
+ * \param width, height : the dimension of the fields
+ * \return BitGrid*
+ */
+BitGrid* getSharedBitGrid(int width, int height);
+
+/**
+ * \fn void setFieldBitGrid(BitGrid* grid, const Field* theField)
+ * \brief function that packs the tiles of a field a path can go through (EMPTY and VISITED) in a grid of bits
+ *
+ * \param grid : the grid, of the dimension of the field
+ * \param theField : the field
+ * \return void
+ */
+void setFieldBitGrid(BitGrid* grid, const Field* theField);
+
+/**
+ * \fn bool isWalkableBitGrid(const BitGrid* grid, int x, int y)
+ * \brief function which check if a path can go through a tile of a grid of bits
+ *
+ * \param grid : the grid
+ * \param x, y : the coordinate to check, which can be outside of the field
+ * \return bool
+ */
+bool isWalkableBitGrid(const BitGrid* grid, int x, int y);
+
+/**
+ * \fn void floodBitGrid(BitGrid* grid, int x, int y)
+ * \brief function that finds all the tiles which can be reached from a position by going through the walkable tiles.
+ * Like the A* algorithme, the position itself can be a wall
+ *
+ * \param grid : the grid, whose walkable tiles have been set
+ * \param x, y : the coordinate of the position, inside the field
+ * \return void
+ */
+void floodBitGrid(BitGrid* grid, int x, int y);
+
+/**
+ * \fn bool isReachedBitGrid(const BitGrid* grid, int x, int y)
+ * \brief function which check if a tile has been reached by the last flood of a grid of bits
+ *
+ * \param grid : the grid
+ * \param x, y : the coordinate to check, which can be outside of the field
+ * \return bool
+ */
+bool isReachedBitGrid(const BitGrid* grid, int x, int y);
+
+/**
+ * \fn int getDistanceBitGrid(BitGrid* grid, int xStart, int yStart, int xEnd, int yEnd)
+ * \brief function that returns the number of steps of a shortest path between two positions,
+ * by moving the frontier of a breadth first search one step at a time on whole rows.
+ * The tiles reached by the search are left in the reached tiles of the grid
+ *
+ * \param grid : the grid, whose walkable tiles have been set
+ * \param xStart, yStart : the coordinate of the start, inside the field, which can be a wall
+ * \param xEnd, yEnd : the coordinate of the end
+ * \return int : the number of steps, -1 if the end can't be reached
+ */
+int getDistanceBitGrid(BitGrid* grid, int xStart, int yStart, int xEnd, int yEnd);
+
+#endif
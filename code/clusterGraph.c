@@ -0,0 +1,728 @@
+/**
+ * \file clusterGraph.c
+ * \brief The hierarchical pathfinding
+ * \version 0.1
+ * \date 17/10/2026
+ *
+ * Module that cuts a field in square clusters to search paths on big fields (HPA*).
+ * The tiles through which a path can go from a cluster to its neighbors are the entrances of the cluster,
+ * and the distances between the entrances of a cluster are kept until one of its tiles changes.
+ * A path is then searched between the entrances instead of between all the tiles of the field,
+ * and only its first part, up to the first entrance, is made of tiles.
+ *
+ */
+
+//Header files containing the prototypes
+#include "clusterGraph.h"
+
+/**
+ * \fn ClusterGraph* initClusterGraph(int width, int height, int clusterSize)
+ * \brief function that creates the clusters of the fields of the given dimension
+ * Nothing is computed before a field is given with setMapClusterGraph
+ *
+ * \param width, height : the dimension of the fields
+ * \param clusterSize : the width and height of the clusters
+ * \return ClusterGraph*
+ */
+ClusterGraph* initClusterGraph(int width, int height, int clusterSize)
+{
+    ClusterGraph* graph = (ClusterGraph*)malloc(sizeof(ClusterGraph));
+    graph->width = width;
+    graph->height = height;
+    graph->clusterSize = clusterSize;
+    graph->nbClustersX = (width + clusterSize - 1) / clusterSize;
+    graph->nbClustersY = (height + clusterSize - 1) / clusterSize;
+    graph->map = NULL;
+    graph->maxEntrances = 4 * ((clusterSize + 1) / 2);
+
+    int nbClusters = graph->nbClustersX * graph->nbClustersY;
+    graph->clusters = (Cluster*)malloc(sizeof(Cluster) * nbClusters);
+    int index;
+    for(index = 0; index < nbClusters; index++)
+    {
+        Cluster* cluster = &(graph->clusters[index]);
+        cluster->xMin = (index % graph->nbClustersX) * clusterSize;
+        cluster->yMin = (index / graph->nbClustersX) * clusterSize;
+        cluster->xMax = cluster->xMin + clusterSize - 1;
+        cluster->yMax = cluster->yMin + clusterSize - 1;
+        //The last clusters are cut by the borders of the field
+        if(cluster->xMax > width - 1)
+        {
+            cluster->xMax = width - 1;
+        }
+        if(cluster->yMax > height - 1)
+        {
+            cluster->yMax = height - 1;
+        }
+        //Nothing is computed before the graph has a field
+        cluster->isValid = true;
+        cluster->nbEntrances = 0;
+        cluster->capacity = 0;
+        cluster->entrances = NULL;
+        cluster->distances = NULL;
+        cluster->firstEntrance = index * graph->maxEntrances;
+    }
+
+    graph->cost = (int*)malloc(sizeof(int) * nbClusters * graph->maxEntrances);
+    graph->parent = (int*)malloc(sizeof(int) * nbClusters * graph->maxEntrances);
+    graph->stamp = (uint32_t*)calloc(nbClusters * graph->maxEntrances, sizeof(uint32_t));
+    graph->generation = 0;
+    graph->heapSize = 0;
+    graph->heapCapacity = 64;
+    graph->heap = (int*)malloc(sizeof(int) * graph->heapCapacity);
+    graph->heapKey = (int*)malloc(sizeof(int) * graph->heapCapacity);
+
+    int paddedSize = (clusterSize + 2) * (clusterSize + 2);
+    graph->walkable = (bool*)malloc(sizeof(bool) * paddedSize);
+    graph->startDistance = (int*)malloc(sizeof(int) * paddedSize);
+    graph->startParent = (int*)malloc(sizeof(int) * paddedSize);
+    graph->endDistance = (int*)malloc(sizeof(int) * paddedSize);
+    graph->entranceDistance = (int*)malloc(sizeof(int) * paddedSize);
+    graph->queue = (int*)malloc(sizeof(int) * paddedSize);
+    return graph;
+}
+
+/**
+ * \fn void destructClusterGraph(ClusterGraph** graph)
+ * \brief function that free the clusters of a field out of memory
+ *
+ * \param graph : a double pointer on the cluster graph
+ * \return void
+ */
+void destructClusterGraph(ClusterGraph** graph)
+{
+    if(graph != NULL)
+    {
+        if(*graph != NULL)
+        {
+            int index;
+            for(index = 0; index < (*graph)->nbClustersX * (*graph)->nbClustersY; index++)
+            {
+                free((*graph)->clusters[index].entrances);
+                free((*graph)->clusters[index].distances);
+            }
+            free((*graph)->clusters);
+            free((*graph)->cost);
+            free((*graph)->parent);
+            free((*graph)->stamp);
+            free((*graph)->heap);
+            free((*graph)->heapKey);
+            free((*graph)->walkable);
+            free((*graph)->startDistance);
+            free((*graph)->startParent);
+            free((*graph)->endDistance);
+            free((*graph)->entranceDistance);
+            free((*graph)->queue);
+            free(*graph);
+            *graph = NULL;
+        }
+    }
+}
+
+/**
+ * \fn static void invalidateCluster(ClusterGraph* graph, int xCluster, int yCluster)
+ * \brief function that marks a cluster to be computed again the next time a search reaches it
+ *
+ * \param graph : the cluster graph
+ * \param xCluster, yCluster : the coordinate of the cluster, which can be outside of the graph
+ * \return void
+ */
+static void invalidateCluster(ClusterGraph* graph, int xCluster, int yCluster)
+{
+    if(xCluster >= 0 && xCluster < graph->nbClustersX && yCluster >= 0 && yCluster < graph->nbClustersY)
+    {
+        graph->clusters[yCluster * graph->nbClustersX + xCluster].isValid = false;
+    }
+}
+
+/**
+ * \fn void setMapClusterGraph(ClusterGraph* graph, const Field* map)
+ * \brief function that gives the field on which the paths are searched. If it changed, all the clusters will be computed again
+ *
+ * \param graph : the cluster graph
+ * \param map : the field, of the dimension of the graph
+ * \return void
+ */
+void setMapClusterGraph(ClusterGraph* graph, const Field* map)
+{
+    if(graph->map != map)
+    {
+        graph->map = map;
+        int xCluster, yCluster;
+        for(yCluster = 0; yCluster < graph->nbClustersY; yCluster++)
+        {
+            for(xCluster = 0; xCluster < graph->nbClustersX; xCluster++)
+            {
+                invalidateCluster(graph, xCluster, yCluster);
+            }
+        }
+    }
+}
+
+/**
+ * \fn void updateTileClusterGraph(ClusterGraph* graph, int x, int y)
+ * \brief function that tells a cluster graph that a tile of its field changed
+ * Only the cluster of the tile, and the neighbor cluster when the tile is on their border, are computed again
+ * the next time a search reaches them
+ *
+ * \param graph : the cluster graph
+ * \param x, y : the coordinate of the tile which changed
+ * \return void
+ */
+void updateTileClusterGraph(ClusterGraph* graph, int x, int y)
+{
+    if(graph != NULL && graph->map != NULL)
+    {
+        int xCluster = x / graph->clusterSize;
+        int yCluster = y / graph->clusterSize;
+        invalidateCluster(graph, xCluster, yCluster);
+        //A tile on a border also changes the entrances of the cluster on the other side
+        if(x % graph->clusterSize == 0)
+        {
+            invalidateCluster(graph, xCluster - 1, yCluster);
+        }
+        if(x % graph->clusterSize == graph->clusterSize - 1)
+        {
+            invalidateCluster(graph, xCluster + 1, yCluster);
+        }
+        if(y % graph->clusterSize == 0)
+        {
+            invalidateCluster(graph, xCluster, yCluster - 1);
+        }
+        if(y % graph->clusterSize == graph->clusterSize - 1)
+        {
+            invalidateCluster(graph, xCluster, yCluster + 1);
+        }
+    }
+}
+
+/**
+ * \fn static int getClusterOfTile(ClusterGraph* graph, int x, int y)
+ * \brief function that returns the index of the cluster which contains a tile
+ *
+ * \param graph : the cluster graph
+ * \param x, y : the coordinate of the tile
+ * \return int
+ */
+static int getClusterOfTile(ClusterGraph* graph, int x, int y)
+{
+    return (y / graph->clusterSize) * graph->nbClustersX + x / graph->clusterSize;
+}
+
+/**
+ * \fn static int findEntrance(Cluster* cluster, int tile)
+ * \brief function that returns the index of a tile among the entrances of a cluster
+ *
+ * \param cluster : the cluster
+ * \param tile : the index of the tile in the field
+ * \return int : -1 if the tile is not an entrance of the cluster
+ */
+static int findEntrance(Cluster* cluster, int tile)
+{
+    int index;
+    for(index = 0; index < cluster->nbEntrances; index++)
+    {
+        if(cluster->entrances[index] == tile)
+        {
+            return index;
+        }
+    }
+    return -1;
+}
+
+/**
+ * \fn static void addEntrance(Cluster* cluster, int tile)
+ * \brief function that adds a tile to the entrances of a cluster, if it is not already one of them
+ *
+ * \param cluster : the cluster
+ * \param tile : the index of the tile in the field
+ * \return void
+ */
+static void addEntrance(Cluster* cluster, int tile)
+{
+    if(findEntrance(cluster, tile) == -1)
+    {
+        if(cluster->nbEntrances == cluster->capacity)
+        {
+            cluster->capacity = 2 * cluster->capacity + 4;
+            cluster->entrances = (int*)realloc(cluster->entrances, sizeof(int) * cluster->capacity);
+        }
+        cluster->entrances[cluster->nbEntrances] = tile;
+        cluster->nbEntrances++;
+    }
+}
+
+/**
+ * \fn static void addBorderEntrances(ClusterGraph* graph, Cluster* cluster, int x, int y, int xStep, int yStep, int xOut, int yOut, int length)
+ * \brief function that adds the entrances of a cluster on one of its borders. The border is cut in parts where
+ * a path can cross it, and each part gets one entrance in its middle, or two at its ends if it is long.
+ * The cluster on the other side finds the same positions, so their entrances face each other
+ *
+ * \param graph : the cluster graph
+ * \param cluster : the cluster
+ * \param x, y : the coordinate of the first tile of the border, inside the cluster
+ * \param xStep, yStep : the move from a tile of the border to the next one
+ * \param xOut, yOut : the move from a tile of the border to the tile on the other side
+ * \param length : the number of tiles of the border
+ * \return void
+ */
+static void addBorderEntrances(ClusterGraph* graph, Cluster* cluster, int x, int y, int xStep, int yStep, int xOut, int yOut, int length)
+{
+    int first = -1;
+    int position;
+    for(position = 0; position <= length; position++)
+    {
+        int xTile = x + position * xStep;
+        int yTile = y + position * yStep;
+        bool isOpen = position < length && isWalkableTile(graph->map, xTile, yTile) &&
+                      isWalkableTile(graph->map, xTile + xOut, yTile + yOut);
+        if(isOpen && first == -1)
+        {
+            first = position;
+        }
+        else if(!isOpen && first != -1)
+        {
+            int last = position - 1;
+            if(last - first + 1 >= LONG_ENTRANCE_LENGTH)
+            {
+                addEntrance(cluster, (y + first * yStep) * graph->width + x + first * xStep);
+                addEntrance(cluster, (y + last * yStep) * graph->width + x + last * xStep);
+            }
+            else
+            {
+                int middle = (first + last) / 2;
+                addEntrance(cluster, (y + middle * yStep) * graph->width + x + middle * xStep);
+            }
+            first = -1;
+        }
+    }
+}
+
+/**
+ * \fn static int getLocalTile(ClusterGraph* graph, Cluster* cluster, int tile)
+ * \brief function that returns the index of a tile of the field in the arrays of the searches inside a cluster
+ *
+ * \param graph : the cluster graph
+ * \param cluster : the cluster
+ * \param tile : the index of the tile in the field, inside the cluster or on its border
+ * \return int
+ */
+static int getLocalTile(ClusterGraph* graph, Cluster* cluster, int tile)
+{
+    return (tile / graph->width - cluster->yMin + 1) * (graph->clusterSize + 2) + tile % graph->width - cluster->xMin + 1;
+}
+
+/**
+ * \fn static void loadCluster(ClusterGraph* graph, Cluster* cluster)
+ * \brief function that reads the tiles of a cluster through which a path can go, before searching inside it
+ * The tiles around the cluster are read as tiles which can't be crossed, so the searches don't leave it
+ *
+ * \param graph : the cluster graph
+ * \param cluster : the cluster
+ * \return void
+ */
+static void loadCluster(ClusterGraph* graph, Cluster* cluster)
+{
+    int paddedWidth = graph->clusterSize + 2;
+    memset(graph->walkable, 0, sizeof(bool) * paddedWidth * paddedWidth);
+    int x, y;
+    for(y = cluster->yMin; y <= cluster->yMax; y++)
+    {
+        bool* row = graph->walkable + (y - cluster->yMin + 1) * paddedWidth + 1 - cluster->xMin;
+        for(x = cluster->xMin; x <= cluster->xMax; x++)
+        {
+            row[x] = isWalkableTile(graph->map, x, y);
+        }
+    }
+}
+
+/**
+ * \fn static void searchInCluster(ClusterGraph* graph, Cluster* cluster, int tile, int* distance, int* parent)
+ * \brief function that goes through the tiles of the loaded cluster which can be reached from a tile, without leaving the cluster
+ * The arrays are indexed like getLocalTile
+ *
+ * \param graph : the cluster graph, with the cluster loaded by loadCluster
+ * \param cluster : the cluster
+ * \param tile : the index in the field of the tile from which the search starts
+ * \param distance : filled with the distance of each tile of the cluster, INFINITE_DISTANCE if it can't be reached
+ * \param parent : filled with the tile each tile is reached from, -1 for the start. Can be NULL
+ * \return void
+ */
+static void searchInCluster(ClusterGraph* graph, Cluster* cluster, int tile, int* distance, int* parent)
+{
+    int paddedWidth = graph->clusterSize + 2;
+    //The neighbors are visited in the same order as addNeighbors : left, right, up, down
+    const int offsets[4] = {-1, 1, -paddedWidth, paddedWidth};
+    int first = 0;
+    int last = 0;
+
+    int index;
+    for(index = 0; index < paddedWidth * paddedWidth; index++)
+    {
+        distance[index] = INFINITE_DISTANCE;
+    }
+    int start = getLocalTile(graph, cluster, tile);
+    distance[start] = 0;
+    if(parent != NULL)
+    {
+        parent[start] = -1;
+    }
+    graph->queue[last++] = start;
+
+    while(first < last)
+    {
+        int current = graph->queue[first++];
+        int direction;
+        for(direction = 0; direction < 4; direction++)
+        {
+            int next = current + offsets[direction];
+            if(graph->walkable[next] && distance[next] == INFINITE_DISTANCE)
+            {
+                distance[next] = distance[current] + 1;
+                if(parent != NULL)
+                {
+                    parent[next] = current;
+                }
+                graph->queue[last++] = next;
+            }
+        }
+    }
+}
+
+/**
+ * \fn static int getClusterDistance(ClusterGraph* graph, Cluster* cluster, int* distance, int tile)
+ * \brief function that reads the distance of a tile of a cluster in the result of searchInCluster
+ *
+ * \param graph : the cluster graph
+ * \param cluster : the cluster
+ * \param distance : the distances filled by searchInCluster
+ * \param tile : the index of the tile in the field
+ * \return int
+ */
+static int getClusterDistance(ClusterGraph* graph, Cluster* cluster, int* distance, int tile)
+{
+    return distance[getLocalTile(graph, cluster, tile)];
+}
+
+/**
+ * \fn static void computeCluster(ClusterGraph* graph, Cluster* cluster)
+ * \brief function that finds the entrances of a cluster and the distances between them
+ *
+ * \param graph : the cluster graph
+ * \param cluster : the cluster
+ * \return void
+ */
+static void computeCluster(ClusterGraph* graph, Cluster* cluster)
+{
+    int width = cluster->xMax - cluster->xMin + 1;
+    int height = cluster->yMax - cluster->yMin + 1;
+    cluster->nbEntrances = 0;
+    //We go through the borders which have a cluster on their other side : left, right, up and down
+    if(cluster->xMin > 0)
+    {
+        addBorderEntrances(graph, cluster, cluster->xMin, cluster->yMin, 0, 1, -1, 0, height);
+    }
+    if(cluster->xMax < graph->width - 1)
+    {
+        addBorderEntrances(graph, cluster, cluster->xMax, cluster->yMin, 0, 1, 1, 0, height);
+    }
+    if(cluster->yMin > 0)
+    {
+        addBorderEntrances(graph, cluster, cluster->xMin, cluster->yMin, 1, 0, 0, -1, width);
+    }
+    if(cluster->yMax < graph->height - 1)
+    {
+        addBorderEntrances(graph, cluster, cluster->xMin, cluster->yMax, 1, 0, 0, 1, width);
+    }
+
+    free(cluster->distances);
+    cluster->distances = (int*)malloc(sizeof(int) * (cluster->nbEntrances * cluster->nbEntrances + 1));
+    loadCluster(graph, cluster);
+    int i, j;
+    for(i = 0; i < cluster->nbEntrances; i++)
+    {
+        searchInCluster(graph, cluster, cluster->entrances[i], graph->entranceDistance, NULL);
+        for(j = 0; j < cluster->nbEntrances; j++)
+        {
+            cluster->distances[i * cluster->nbEntrances + j] = getClusterDistance(graph, cluster, graph->entranceDistance, cluster->entrances[j]);
+        }
+    }
+    cluster->isValid = true;
+}
+
+/**
+ * \fn static Cluster* getCluster(ClusterGraph* graph, int index)
+ * \brief function that returns a cluster, after computing it again if it changed
+ *
+ * \param graph : the cluster graph
+ * \param index : the index of the cluster
+ * \return Cluster*
+ */
+static Cluster* getCluster(ClusterGraph* graph, int index)
+{
+    Cluster* cluster = &(graph->clusters[index]);
+    if(!cluster->isValid)
+    {
+        computeCluster(graph, cluster);
+    }
+    return cluster;
+}
+
+/**
+ * \fn static void pushClusterHeap(ClusterGraph* graph, int entrance, int key)
+ * \brief function that adds an entrance to the heap of the search. An entrance can be added several times,
+ * the copies with an outdated key are skipped when they are poped
+ *
+ * \param graph : the cluster graph
+ * \param entrance : the number of the entrance
+ * \param key : its cost from the start plus its manhattan distance to the end
+ * \return void
+ */
+static void pushClusterHeap(ClusterGraph* graph, int entrance, int key)
+{
+    if(graph->heapSize == graph->heapCapacity)
+    {
+        graph->heapCapacity *= 2;
+        graph->heap = (int*)realloc(graph->heap, sizeof(int) * graph->heapCapacity);
+        graph->heapKey = (int*)realloc(graph->heapKey, sizeof(int) * graph->heapCapacity);
+    }
+    int index = graph->heapSize;
+    graph->heapSize++;
+    //We move the new entrance up to its place
+    while(index > 0 && graph->heapKey[(index - 1) / 2] > key)
+    {
+        graph->heap[index] = graph->heap[(index - 1) / 2];
+        graph->heapKey[index] = graph->heapKey[(index - 1) / 2];
+        index = (index - 1) / 2;
+    }
+    graph->heap[index] = entrance;
+    graph->heapKey[index] = key;
+}
+
+/**
+ * \fn static int popClusterHeap(ClusterGraph* graph, int* key)
+ * \brief function that removes the entrance with the lowest key from the heap of the search
+ *
+ * \param graph : the cluster graph, with a heap which is not empty
+ * \param key : set to the key of the entrance
+ * \return int : the number of the entrance
+ */
+static int popClusterHeap(ClusterGraph* graph, int* key)
+{
+    int entrance = graph->heap[0];
+    *key = graph->heapKey[0];
+    graph->heapSize--;
+    int lastEntrance = graph->heap[graph->heapSize];
+    int lastKey = graph->heapKey[graph->heapSize];
+    //We move the last entrance down from the top to its place
+    int index = 0;
+    bool isPlaced = false;
+    while(!isPlaced)
+    {
+        int child = 2 * index + 1;
+        if(child + 1 < graph->heapSize && graph->heapKey[child + 1] < graph->heapKey[child])
+        {
+            child++;
+        }
+        if(child < graph->heapSize && graph->heapKey[child] < lastKey)
+        {
+            graph->heap[index] = graph->heap[child];
+            graph->heapKey[index] = graph->heapKey[child];
+            index = child;
+        }
+        else
+        {
+            isPlaced = true;
+        }
+    }
+    graph->heap[index] = lastEntrance;
+    graph->heapKey[index] = lastKey;
+    return entrance;
+}
+
+/**
+ * \fn static void reachEntrance(ClusterGraph* graph, int entrance, int cost, int parent, node* endNode)
+ * \brief function that records a way to reach an entrance, if it is shorter than the one already known
+ *
+ * \param graph : the cluster graph
+ * \param entrance : the number of the entrance
+ * \param cost : its cost from the start
+ * \param parent : the entrance from which it is reached, -1 if it is reached from the start
+ * \param endNode : the end node of the search
+ * \return void
+ */
+static void reachEntrance(ClusterGraph* graph, int entrance, int cost, int parent, node* endNode)
+{
+    if(graph->stamp[entrance] != graph->generation || cost < graph->cost[entrance])
+    {
+        Cluster* cluster = &(graph->clusters[entrance / graph->maxEntrances]);
+        int tile = cluster->entrances[entrance - cluster->firstEntrance];
+        graph->stamp[entrance] = graph->generation;
+        graph->cost[entrance] = cost;
+        graph->parent[entrance] = parent;
+        pushClusterHeap(graph, entrance, cost + abs(tile % graph->width - endNode->x) + abs(tile / graph->width - endNode->y));
+    }
+}
+
+/**
+ * \fn static node* getPathInCluster(ClusterGraph* graph, Cluster* cluster, int tile)
+ * \brief function that creates the chain list of nodes from the start of the last search to a tile of its cluster
+ *
+ * \param graph : the cluster graph
+ * \param cluster : the cluster of the start
+ * \param tile : the index in the field of the last tile of the path
+ * \return node*
+ */
+static node* getPathInCluster(ClusterGraph* graph, Cluster* cluster, int tile)
+{
+    node* path = NULL;
+    int paddedWidth = graph->clusterSize + 2;
+    int current = getLocalTile(graph, cluster, tile);
+    int cost = graph->startDistance[current];
+    //We insert the nodes from the end to the start, so the start ends up on top of the chain list
+    while(current != -1)
+    {
+        insertFrontNode(&path, initNode(cluster->xMin + current % paddedWidth - 1, cluster->yMin + current / paddedWidth - 1, cost, 0));
+        cost--;
+        current = graph->startParent[current];
+    }
+    return path;
+}
+
+/**
+ * \fn node* findFirstPathClusterGraph(ClusterGraph* graph, node* startNode, node* endNode)
+ * \brief function that searches a path between two tiles through the entrances of the clusters,
+ * and returns the tiles of its first part : up to the first entrance it goes through, or up to the end node
+ * if it does not leave the cluster of the start node. The path is a shortest path among the ones which cross
+ * the borders of the clusters at their entrances, so it can be a bit longer than the shortest one
+ *
+ * \param graph : the cluster graph, with a field
+ * \param startNode : the starting node of the path
+ * \param endNode : the end node of the path
+ * \return node* : the first part of the path, startNode if there is no path
+ */
+node* findFirstPathClusterGraph(ClusterGraph* graph, node* startNode, node* endNode)
+{
+    if(!isWalkableTile(graph->map, endNode->x, endNode->y))
+    {
+        return startNode;
+    }
+    int startTile = startNode->y * graph->width + startNode->x;
+    int endTile = endNode->y * graph->width + endNode->x;
+    Cluster* startCluster = getCluster(graph, getClusterOfTile(graph, startNode->x, startNode->y));
+    Cluster* endCluster = getCluster(graph, getClusterOfTile(graph, endNode->x, endNode->y));
+    loadCluster(graph, startCluster);
+    //The start can be searched from even if a path can't go through it
+    graph->walkable[getLocalTile(graph, startCluster, startTile)] = true;
+    searchInCluster(graph, startCluster, startTile, graph->startDistance, graph->startParent);
+    loadCluster(graph, endCluster);
+    searchInCluster(graph, endCluster, endTile, graph->endDistance, NULL);
+
+    //The best way known to the end : directly inside the cluster, or through an entrance of the end cluster
+    int bestCost = INFINITE_DISTANCE;
+    int bestEntrance = -1;
+    if(startCluster == endCluster)
+    {
+        bestCost = getClusterDistance(graph, startCluster, graph->startDistance, endTile);
+    }
+
+    //We start from the entrances which can be reached inside the cluster of the start
+    graph->generation++;
+    graph->heapSize = 0;
+    int index;
+    for(index = 0; index < startCluster->nbEntrances; index++)
+    {
+        int cost = getClusterDistance(graph, startCluster, graph->startDistance, startCluster->entrances[index]);
+        if(cost != INFINITE_DISTANCE)
+        {
+            reachEntrance(graph, startCluster->firstEntrance + index, cost, -1, endNode);
+        }
+    }
+
+    while(graph->heapSize > 0)
+    {
+        int key;
+        int entrance = popClusterHeap(graph, &key);
+        Cluster* cluster = &(graph->clusters[entrance / graph->maxEntrances]);
+        int local = entrance - cluster->firstEntrance;
+        int tile = cluster->entrances[local];
+        int cost = graph->cost[entrance];
+        if(key >= bestCost)
+        {
+            //No entrance left can lead to a shorter way
+            break;
+        }
+        if(key != cost + abs(tile % graph->width - endNode->x) + abs(tile / graph->width - endNode->y))
+        {
+            //A shorter way to this entrance has been found since it was added
+            continue;
+        }
+        if(cluster == endCluster)
+        {
+            int endCost = getClusterDistance(graph, endCluster, graph->endDistance, tile);
+            if(endCost != INFINITE_DISTANCE && cost + endCost < bestCost)
+            {
+                bestCost = cost + endCost;
+                bestEntrance = entrance;
+            }
+        }
+        //The other entrances of the cluster
+        for(index = 0; index < cluster->nbEntrances; index++)
+        {
+            int distance = cluster->distances[local * cluster->nbEntrances + index];
+            if(distance != INFINITE_DISTANCE)
+            {
+                reachEntrance(graph, cluster->firstEntrance + index, cost + distance, entrance, endNode);
+            }
+        }
+        //The entrances of the neighbor clusters next to this one : left, right, up and down
+        const int xOffsets[4] = {-1, 1, 0, 0};
+        const int yOffsets[4] = {0, 0, -1, 1};
+        int direction;
+        for(direction = 0; direction < 4; direction++)
+        {
+            int x = tile % graph->width + xOffsets[direction];
+            int y = tile / graph->width + yOffsets[direction];
+            if(x >= 0 && x < graph->width && y >= 0 && y < graph->height)
+            {
+                Cluster* neighbor = getCluster(graph, getClusterOfTile(graph, x, y));
+                if(neighbor != cluster && isWalkableTile(graph->map, x, y))
+                {
+                    int neighborEntrance = findEntrance(neighbor, y * graph->width + x);
+                    if(neighborEntrance != -1)
+                    {
+                        reachEntrance(graph, neighbor->firstEntrance + neighborEntrance, cost + 1, entrance, endNode);
+                    }
+                }
+            }
+        }
+    }
+
+    if(bestCost == INFINITE_DISTANCE)
+    {
+        //We return just the starting node, which means their is no path
+        return startNode;
+    }
+    if(bestEntrance == -1)
+    {
+        //The path does not leave the cluster of the start
+        return getPathInCluster(graph, startCluster, endTile);
+    }
+    //We go back to the first entrance of the path which is not the start itself
+    int firstEntrance = bestEntrance;
+    while(graph->parent[firstEntrance] != -1 &&
+          (graph->parent[graph->parent[firstEntrance]] != -1 || graph->cost[graph->parent[firstEntrance]] > 0))
+    {
+        firstEntrance = graph->parent[firstEntrance];
+    }
+    Cluster* cluster = &(graph->clusters[firstEntrance / graph->maxEntrances]);
+    int firstTile = cluster->entrances[firstEntrance - cluster->firstEntrance];
+    if(cluster == startCluster)
+    {
+        return getPathInCluster(graph, startCluster, firstTile);
+    }
+    //The start is an entrance, and the path begins by crossing the border
+    node* path = initNode(startNode->x, startNode->y, 0, 0);
+    path->linkedNode = initNode(firstTile % graph->width, firstTile / graph->width, 1, 0);
+    return path;
+}
@@ -0,0 +1,141 @@
+/**
+ * \file clusterGraph.h
+ * \brief Prototypes of the hierarchical pathfinding
+ * \version 0.1
+ * \date 17/10/2026
+ *
+ * Module that cuts a field in square clusters to search paths on big fields (HPA*).
+ * The tiles through which a path can go from a cluster to its neighbors are the entrances of the cluster,
+ * and the distances between the entrances of a cluster are kept until one of its tiles changes.
+ * A path is then searched between the entrances instead of between all the tiles of the field,
+ * and only its first part, up to the first entrance, is made of tiles.
+ *
+ */
+
+#ifndef H_CLUSTERGRAPH
+    #define H_CLUSTERGRAPH
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "prototype.h"
+#include "pathfinding.h"
+
+//Width and height of the clusters of a field
+#ifndef CLUSTER_SIZE
+    #define CLUSTER_SIZE (16)
+#endif
+
+//Length of the walkable parts of a border from which two entrances are used, one at each end, instead of one in the middle
+#define LONG_ENTRANCE_LENGTH (6)
+
+//A square part of a field, with its entrances
+typedef struct Cluster
+{
+    //Bounds of the cluster in the field, included
+    int xMin, xMax;
+    int yMin, yMax;
+    bool isValid;
+    //The tiles of the entrances of the cluster
+    int nbEntrances;
+    int capacity;
+    int* entrances;
+    //Distance between each pair of entrances, going only through the cluster (INFINITE_DISTANCE if there is no path)
+    int* distances;
+    //Number of the first entrance of the cluster among all the entrances of the field.
+    //Each cluster has its own range of numbers, so changing a cluster doesn't number the other ones again
+    int firstEntrance;
+} Cluster;
+
+//The clusters of a field and the data used to search a path between their entrances
+typedef struct ClusterGraph
+{
+    int width;
+    int height;
+    int clusterSize;
+    int nbClustersX;
+    int nbClustersY;
+    const Field* map;
+    //The clusters, which are only computed when a search reaches them
+    Cluster* clusters;
+    //The number of entrances a cluster can have : each part of a border where a path can cross it has one or two entrances,
+    //and the parts are separated by at least one tile, so a border of n tiles has at most (n+1)/2 entrances
+    int maxEntrances;
+    //For each entrance of the field, its cost from the start, the entrance it was reached from and the search which reached it
+    int* cost;
+    int* parent;
+    uint32_t* stamp;
+    uint32_t generation;
+    //Binary min-heap of the entrances to visit
+    int* heap;
+    int* heapKey;
+    int heapSize;
+    int heapCapacity;
+    //Breadth first searches inside one cluster, from the start and from the end of a path.
+    //They are indexed on the tiles of the cluster with a border of one tile around it, row by row
+    bool* walkable;
+    int* startDistance;
+    int* startParent;
+    int* endDistance;
+    int* entranceDistance;
+    int* queue;
+} ClusterGraph;
+
+/**
+ * \fn ClusterGraph* initClusterGraph(int width, int height, int clusterSize)
+ * \brief function that creates the clusters of the fields of the given dimension
+ * Nothing is computed before a field is given with setMapClusterGraph
+ *
+ * \param width, height : the dimension of the fields
+ * \param clusterSize : the width and height of the clusters
+ * \return ClusterGraph*
+ */
+ClusterGraph* initClusterGraph(int width, int height, int clusterSize);
+
+/**
+ * \fn void destructClusterGraph(ClusterGraph** graph)
+ * \brief function that free the clusters of a field out of memory
+ *
+ * \param graph : a double pointer on the cluster graph
+ * \return void
+ */
+void destructClusterGraph(ClusterGraph** graph);
+
+/**
+ * \fn void setMapClusterGraph(ClusterGraph* graph, const Field* map)
+ * \brief function that gives the field on which the paths are searched. If it changed, all the clusters will be computed again
+ *
+ * \param graph : the cluster graph
+ * \param map : the field, of the dimension of the graph
+ * \return void
+ */
+void setMapClusterGraph(ClusterGraph* graph, const Field* map);
+
+/**
+ * \fn void updateTileClusterGraph(ClusterGraph* graph, int x, int y)
+ * \brief function that tells a cluster graph that a tile of its field changed
+ * Only the cluster of the tile, and the neighbor cluster when the tile is on their border, are computed again
+ * the next time a search reaches them
+ *
+ * \param graph : the cluster graph
+ * \param x, y : the coordinate of the tile which changed
+ * \return void
+ */
+void updateTileClusterGraph(ClusterGraph* graph, int x, int y);
+
+/**
+ * \fn node* findFirstPathClusterGraph(ClusterGraph* graph, node* startNode, node* endNode)
+ * \brief function that searches a path between two tiles through the entrances of the clusters,
+ * and returns the tiles of its first part : up to the first entrance it goes through, or up to the end node
+ * if it does not leave the cluster of the start node. The path is a shortest path among the ones which cross
+ * the borders of the clusters at their entrances, so it can be a bit longer than the shortest one
+ *
+ * \param graph : the cluster graph, with a field
+ * \param startNode : the starting node of the path
+ * \param endNode : the end node of the path
+ * \return node* : the first part of the path, startNode if there is no path
+ */
+node* findFirstPathClusterGraph(ClusterGraph* graph, node* startNode, node* endNode);
+
+#endif
@@ -14,24 +14,24 @@
 
 
 /**
- * \fn int **create2DIntArray(int height, int width)
- * \brief function that creates a 2 dimension array of int
+ * \fn Field *allocateField(int width, int height)
+ * \brief function that allocates a field and its contiguous buffer of tiles, without initializing the tiles
  *
- * \param width : width of the array
- * \param height : height of the array
- * \return int** : A pointer to the created array
+ * \param width : width of the field
+ * \param height : height of the field
+ * \return Field : Pointer to a Field, which is a tydef declared in core.h (2D array struct)
  */
-int **create2DIntArray(int width, int height)
+Field *allocateField(int width, int height)
 {
-    int **array = (int**)malloc(sizeof(int*) * width);
-    
-    int widthIndex;
-    for(widthIndex = 0; widthIndex < width; widthIndex++)
-    {
-        array[widthIndex] = (int*)malloc(sizeof(int) * height);
-    }
+    Field *oneField = (Field*)malloc(sizeof(Field));
+
+    oneField->width = width;
+    oneField->height = height;
+    oneField->stride = width;
+    //All the tiles are allocated at once, row by row
+    oneField->data = (fieldTile*)malloc(sizeof(fieldTile) * oneField->stride * height);
 
-    return array;
+    return oneField;
 }
 
 /**
@@ -45,19 +45,17 @@ int **create2DIntArray(int width, int height)
  */
 Field *initialiseField(int width, int height, pointEnum defaultValue)
 {
-    Field *oneField = (Field*)malloc(sizeof(Field));
-
-    oneField->width = width;
-    oneField->height = height;
-    oneField->data = create2DIntArray(width, height);
+    Field *oneField = allocateField(width, height);
 
     int widthIndex, heightIndex;
 
-    for(widthIndex = 0; widthIndex < width; widthIndex++)
+    //We go through the tiles in the order they are stored
+    for(heightIndex = 0; heightIndex < height; heightIndex++)
     {
-        for(heightIndex = 0; heightIndex < height; heightIndex++)
+        fieldTile *row = getFieldRow(oneField, heightIndex);
+        for(widthIndex = 0; widthIndex < width; widthIndex++)
         {
-            oneField->data[widthIndex][heightIndex] = defaultValue;
+            row[widthIndex] = defaultValue;
         }
     }
 
@@ -81,25 +79,23 @@ Field *createCustomField(char *pathImageField)
         return NULL;
     }
     
-    Field *oneField = (Field*)malloc(sizeof(Field));
-    oneField->width = imageCustomField->largeurImage;
-    oneField->height = imageCustomField->hauteurImage;
-    oneField->data = create2DIntArray(oneField->width, oneField->height);
+    Field *oneField = allocateField(imageCustomField->largeurImage, imageCustomField->hauteurImage);
 
     int widthIndex, heightIndex;
     int compteur = 0;
     //Copie des valeurs
 	for(heightIndex = (oneField->height-1); heightIndex >= 0; heightIndex--)
 	{
+        fieldTile *row = getFieldRow(oneField, heightIndex);
 		for(widthIndex = 0; widthIndex < oneField->width; widthIndex++)
 		{
             if(imageCustomField->donneesRGB[compteur] == 255)
             {
-                oneField->data[widthIndex][heightIndex] = EMPTY;
+                row[widthIndex] = EMPTY;
             }
             else
             {
-                oneField->data[widthIndex][heightIndex] = WALL;
+                row[widthIndex] = WALL;
             }
 			compteur = compteur + 3;
 		}
@@ -125,14 +121,14 @@ void generateEnv(Field *oneField)
 
     for(h = 0; h < oneField->height; h++)
     {
-        oneField->data[0][h] = WALL;
-        oneField->data[oneField->width-1][h] = WALL;
+        setFieldTile(oneField, 0, h, WALL);
+        setFieldTile(oneField, oneField->width-1, h, WALL);
     }
 
     for(w = 0; w < oneField->width; w++)
     {
-        oneField->data[w][oneField->height-1] = WALL;
-        oneField->data[w][0] = WALL;
+        setFieldTile(oneField, w, oneField->height-1, WALL);
+        setFieldTile(oneField, w, 0, WALL);
     }    
     
     //First loop, random generation (obstacle or not, Bernoulli)
@@ -144,7 +140,7 @@ void generateEnv(Field *oneField)
 
             if(monRand < 5)
             {
-                oneField->data[w][h] = WALL;
+                setFieldTile(oneField, w, h, WALL);
             }
         }
     }
@@ -154,18 +150,18 @@ void generateEnv(Field *oneField)
     {
         for(h = 1; h < (oneField->height-1); h++)
         {
-            sum_neigh = oneField->data[w-1][h-1] + oneField->data[w-1][h] + oneField->data[w][h-1] + oneField->data[w-1][h+1]
-                        + oneField->data[w+1][h-1] + oneField->data[w+1][h] + oneField->data[w][h+1] + oneField->data[w+1][h+1];
+            sum_neigh = getFieldTile(oneField, w-1, h-1) + getFieldTile(oneField, w-1, h) + getFieldTile(oneField, w, h-1) + getFieldTile(oneField, w-1, h+1)
+                        + getFieldTile(oneField, w+1, h-1) + getFieldTile(oneField, w+1, h) + getFieldTile(oneField, w, h+1) + getFieldTile(oneField, w+1, h+1);
 
             //Clean some obstacles
             if(sum_neigh < 2)
             {
-                oneField->data[w][h] = EMPTY;
+                setFieldTile(oneField, w, h, EMPTY);
             }
             //Prevent stuck
             else if(sum_neigh >= 4)
             {
-                oneField->data[w][h] = EMPTY;
+                setFieldTile(oneField, w, h, EMPTY);
             }
         }
     }
@@ -175,37 +171,16 @@ void generateEnv(Field *oneField)
     {
         for(h = 1; h < (oneField->height-1); h++)
         {
-            sum_neigh = oneField->data[w][h-1] + oneField->data[w-1][h] + oneField->data[w][h+1] + oneField->data[w+1][h];
+            sum_neigh = getFieldTile(oneField, w, h-1) + getFieldTile(oneField, w-1, h) + getFieldTile(oneField, w, h+1) + getFieldTile(oneField, w+1, h);
 
             if(sum_neigh >= 3)
             {
-                oneField->data[w][h] = WALL;
+                setFieldTile(oneField, w, h, WALL);
             }
         }
     }
 }
 
-/**
- * \fn void destruct2DIntArray(int **array, int width)
- * \brief function that free the 2D array out of memory
- *
- * \param **array : The array to free
- * \param width : width of the array
- * \return void
- */
-void destruct2DIntArray(int **array, int width)
-{
-    int i;
-    if(array != NULL)
-    {
-        for(i = 0; i < width; i++)
-        {
-            free(array[i]);
-        }
-        free(array);
-    }
-}
-
 /**
  * \fn void destructField(Field **oneField)
  * \brief function that free the field out of memory
@@ -219,7 +194,7 @@ void destructField(Field **oneField)
     {
         if(*oneField != NULL)
         {
-            destruct2DIntArray((*oneField)->data, (*oneField)->width);
+            free((*oneField)->data);
             (*oneField)->data = NULL;
             free(*oneField);
             *oneField = NULL;
@@ -274,23 +249,108 @@ Field* generateRandomFieldOfView(int visionRange, bool isValid)
     {
         for(height = 0; height < fieldOfView->height; height++)
         {
-            fieldOfView->data[width][height] = rand()%3;
+            setFieldTile(fieldOfView, width, height, rand()%3);
         }
     }
     if (isValid)
     { 
-        fieldOfView->data[visionRange][visionRange] = EMPTY;
+        setFieldTile(fieldOfView, visionRange, visionRange, EMPTY);
     }
     else
     {
-        fieldOfView->data[visionRange][visionRange] = rand()%2 + 1;
+        setFieldTile(fieldOfView, visionRange, visionRange, rand()%2 + 1);
     }
     return fieldOfView;
 }
 
+/**
+ * \fn static int walkLineOfSight(const Field* theField, const FieldView* view, int xOrigin, int yOrigin, int xPosition, int yPosition, int* xCells, int* yCells)
+ * \brief function that steps on the line between an origin and a position one unit of length at a time,
+ * over the tiles a WALL on which hides the position from the origin, and stops at the first WALL
+ *
+ * \param theField : the field the tiles are read from, NULL to read them from the view
+ * \param view : the field view the tiles are read from, NULL to read them from the field
+ * \param int xOrigin : x coordinate of the origin
+ * \param int yOrigin : y coordinate of the origin
+ * \param int xPosition : x coordinate of the position
+ * \param int yPosition : y coordinate of the position
+ * \param xCells, yCells : arrays where the coordinates of the tiles are written, NULL to not write them
+ * \return int : the number of tiles, -1 if one of them is a WALL
+ */
+static int walkLineOfSight(const Field* theField, const FieldView* view, int xOrigin, int yOrigin, int xPosition, int yPosition, int* xCells, int* yCells)
+{
+    float angle = atan2(yPosition - yOrigin, xPosition - xOrigin);
+
+    float dist = sqrt(pow(xPosition-xOrigin, 2) + pow(yPosition-yOrigin, 2));
+
+    float vect[2] = {cos(angle), sin(angle)};
+
+    int nbCells = 0;
+
+    for(int i = 0; i < dist; i++)
+    {
+        int x = (int) (xOrigin + i * vect[0]);
+        int y = (int) (yOrigin + i * vect[1]);
+
+        if (x != xPosition && y != yPosition)
+        {
+            if((theField != NULL && getFieldTile(theField, x, y) == WALL) || (view != NULL && getFieldViewTile(view, x, y) == WALL))
+            {
+                return -1;
+            }
+            if(xCells != NULL)
+            {
+                xCells[nbCells] = x;
+                yCells[nbCells] = y;
+            }
+            nbCells++;
+        }
+    }
+    return nbCells;
+}
+
+/**
+ * \fn static int getLineOfSight(int xOrigin, int yOrigin, int xPosition, int yPosition, int* xCells, int* yCells)
+ * \brief function that finds the tiles a WALL on which hides a position from an origin
+ *
+ * \param int xOrigin : x coordinate of the origin
+ * \param int yOrigin : y coordinate of the origin
+ * \param int xPosition : x coordinate of the position
+ * \param int yPosition : y coordinate of the position
+ * \param xCells, yCells : arrays where the coordinates of the tiles are written, NULL to only count them
+ * \return int : the number of tiles
+ */
+static int getLineOfSight(int xOrigin, int yOrigin, int xPosition, int yPosition, int* xCells, int* yCells)
+{
+    return walkLineOfSight(NULL, NULL, xOrigin, yOrigin, xPosition, yPosition, xCells, yCells);
+}
+
+/**
+ * \fn static const LineOfSightTable* getCenteredLineOfSightTable(int width, int height, int xOrigin, int yOrigin, int xPosition, int yPosition)
+ * \brief function that returns the table of lines of sight to use for a field of view,
+ * if the origin is its center and the position is inside it
+ *
+ * \param width, height : the dimension of the field of view
+ * \param int xOrigin : x coordinate of actual position
+ * \param int yOrigin : y coordinate of actual position
+ * \param int xPosition : x coordinate we want to check
+ * \param int yPosition : y coordinate we want to check
+ * \return const LineOfSightTable* : the table, NULL if there is none for this field of view
+ */
+static const LineOfSightTable* getCenteredLineOfSightTable(int width, int height, int xOrigin, int yOrigin, int xPosition, int yPosition)
+{
+    if(width != height || width % 2 == 0 || xOrigin != (width-1)/2 || yOrigin != (height-1)/2
+        || xPosition < 0 || xPosition >= width || yPosition < 0 || yPosition >= height)
+    {
+        return NULL;
+    }
+    return getSharedLineOfSightTable((width-1)/2);
+}
+
 /**
  * \fn bool isVisibleFrom(Field* fieldOfView, int xOrigin, int yOrigin, int xPosition, int yPosition)
  * \brief function that returns true if a given position is visible from actual position
+ * When the actual position is the center of the field of view, the line of sight is read from the table of its vision range
  *
  * \param Field* fieldOfView : a field of view
  * \param int xOrigin : x coordinate of actual position
@@ -301,28 +361,482 @@ Field* generateRandomFieldOfView(int visionRange, bool isValid)
  */
 bool isVisibleFrom(Field* fieldOfView, int xOrigin, int yOrigin, int xPosition, int yPosition)
 {
-    float angle = atan2(yPosition - yOrigin, xPosition - xOrigin);
+    const LineOfSightTable* table = getCenteredLineOfSightTable(fieldOfView->width, fieldOfView->height, xOrigin, yOrigin, xPosition, yPosition);
+    if(table != NULL)
+    {
+        int index = yPosition*table->size + xPosition;
+        int cell;
+        for(cell = table->first[index]; cell < table->first[index + 1]; cell++)
+        {
+            if(getFieldTile(fieldOfView, table->xCells[cell], table->yCells[cell]) == WALL)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 
-    float dist = sqrt(pow(xPosition-xOrigin, 2) + pow(yPosition-yOrigin, 2));
+    //We follow the line of sight from the origin when it isn't the center of the field of view
+    return walkLineOfSight(fieldOfView, NULL, xOrigin, yOrigin, xPosition, yPosition, NULL, NULL) != -1;
+}
 
-    float vect[2] = {cos(angle), sin(angle)};
+/**
+ * \fn static int floorDivision(int numerator, int denominator)
+ * \brief function that returns the greatest integer not above a fraction, even when it is negative
+ *
+ * \param numerator : the numerator of the fraction
+ * \param denominator : the denominator of the fraction, above 0
+ * \return int
+ */
+static int floorDivision(int numerator, int denominator)
+{
+    int quotient = numerator / denominator;
+    if(numerator % denominator != 0 && numerator < 0)
+    {
+        quotient--;
+    }
+    return quotient;
+}
 
-    bool isVisible = true;
+/**
+ * \fn static bool getTileQuarter(const Field* theField, int xOrigin, int yOrigin, int quarter, int depth, int column, int* x, int* y)
+ * \brief function that returns the coordinate in the field of a tile of a quarter of the vision
+ *
+ * \param theField : the field
+ * \param xOrigin, yOrigin : the coordinate of the position the vision comes from
+ * \param quarter : the quarter of the vision (0 : up, 1 : right, 2 : down, 3 : left)
+ * \param depth : the number of the row of the tile, away from the position
+ * \param column : the number of the tile in its row, 0 being in front of the position
+ * \param x, y : pointers on the coordinate of the tile in the field
+ * \return bool : whether the tile is inside the field
+ */
+static bool getTileQuarter(const Field* theField, int xOrigin, int yOrigin, int quarter, int depth, int column, int* x, int* y)
+{
+    switch(quarter)
+    {
+        case 0:
+            *x = xOrigin + column;
+            *y = yOrigin - depth;
+            break;
+        case 1:
+            *x = xOrigin + depth;
+            *y = yOrigin + column;
+            break;
+        case 2:
+            *x = xOrigin + column;
+            *y = yOrigin + depth;
+            break;
+        default:
+            *x = xOrigin - depth;
+            *y = yOrigin + column;
+            break;
+    }
+    return *x >= 0 && *x < theField->width && *y >= 0 && *y < theField->height;
+}
 
-    for(int i = 0; i < dist; i++)
+/**
+ * \fn static void scanRowFieldOfView(const Field* theField, int xOrigin, int yOrigin, int radius, bool* visible, int quarter, int depth, int startNumerator, int startDenominator, int endNumerator, int endDenominator)
+ * \brief function that reveals the visible tiles of a row of a quarter of the vision, between two slopes,
+ * and scans the next rows between the slopes which are not hidden by the WALLs of the row.
+ * The slopes are fractions (column / depth) of the edges of the tiles, so they are kept as a numerator and a denominator
+ *
+ * \param theField, xOrigin, yOrigin, radius, visible : see castFieldOfView
+ * \param quarter : the quarter of the vision (see getTileQuarter)
+ * \param depth : the number of the row, away from the position
+ * \param startNumerator, startDenominator : the slope from which the row is visible
+ * \param endNumerator, endDenominator : the slope until which the row is visible
+ * \return void
+ */
+static void scanRowFieldOfView(const Field* theField, int xOrigin, int yOrigin, int radius, bool* visible, int quarter, int depth,
+                               int startNumerator, int startDenominator, int endNumerator, int endDenominator)
+{
+    if(depth >= radius)
+    {
+        //No tile of this row is in the vision range
+        return;
+    }
+    int size = 2*radius + 1;
+    //The first and last tiles whose center is between the slopes, the ties being given to the tiles inside
+    int firstColumn = floorDivision(2*depth*startNumerator + startDenominator, 2*startDenominator);
+    int lastColumn = -floorDivision(-(2*depth*endNumerator - endDenominator), 2*endDenominator);
+    //-1 if there is no previous tile, 0 if it is not a wall, 1 if it is a wall
+    int previousIsWall = -1;
+    int column;
+    for(column = firstColumn; column <= lastColumn; column++)
+    {
+        int x, y;
+        //The tiles outside of the field hide the tiles behind them like WALLs
+        bool isWall = true;
+        if(getTileQuarter(theField, xOrigin, yOrigin, quarter, depth, column, &x, &y))
+        {
+            isWall = getFieldTile(theField, x, y) == WALL;
+            //A tile is visible if it is a WALL which can be seen, or if its center is between the slopes,
+            //which makes the vision symmetric
+            bool isCentered = column * startDenominator >= depth * startNumerator && column * endDenominator <= depth * endNumerator;
+            if((isWall || isCentered) && column*column + depth*depth < radius*radius)
+            {
+                visible[(y - yOrigin + radius) * size + x - xOrigin + radius] = true;
+            }
+        }
+        if(previousIsWall == 1 && !isWall)
+        {
+            //The row starts again after the WALL
+            startNumerator = 2*column - 1;
+            startDenominator = 2*depth;
+        }
+        if(previousIsWall == 0 && isWall)
+        {
+            //The part of the row before the WALL is scanned further
+            scanRowFieldOfView(theField, xOrigin, yOrigin, radius, visible, quarter, depth + 1,
+                               startNumerator, startDenominator, 2*column - 1, 2*depth);
+        }
+        previousIsWall = isWall;
+    }
+    if(previousIsWall == 0)
+    {
+        scanRowFieldOfView(theField, xOrigin, yOrigin, radius, visible, quarter, depth + 1,
+                           startNumerator, startDenominator, endNumerator, endDenominator);
+    }
+}
+
+/**
+ * \fn void castFieldOfView(const Field* theField, int xOrigin, int yOrigin, int radius, bool* visible)
+ * \brief function that finds the tiles of a field visible from a position, with a symmetric shadowcasting :
+ * each quarter of the vision is scanned row after row away from the position, and the parts of the rows hidden
+ * by the WALLs are removed from the next rows. Only integers are used, and each tile is read once per quarter.
+ * A tile is visible from a position if and only if the position is visible from the tile
+ *
+ * \param theField : the field
+ * \param xOrigin, yOrigin : the coordinate of the position, inside the field
+ * \param radius : the vision range, only the tiles at a distance lower than it are visible (like in a DiskMask)
+ * \param visible : array of (2*radius + 1)*(2*radius + 1) booleans, set to whether the tile (xOrigin + dx, yOrigin + dy)
+ * is visible at the index (dy + radius)*(2*radius + 1) + dx + radius. The tiles outside of the field are not visible
+ * \return void
+ */
+void castFieldOfView(const Field* theField, int xOrigin, int yOrigin, int radius, bool* visible)
+{
+    int size = 2*radius + 1;
+    memset(visible, false, sizeof(bool) * size * size);
+    if(radius > 0)
+    {
+        visible[radius * size + radius] = true;
+    }
+    int quarter;
+    for(quarter = 0; quarter < 4; quarter++)
+    {
+        //Each quarter starts at the first row, between the two diagonals
+        scanRowFieldOfView(theField, xOrigin, yOrigin, radius, visible, quarter, 1, -1, 1, 1, 1);
+    }
+}
+
+/**
+ * \fn DiskMask* initDiskMask(int radius)
+ * \brief function that creates the mask of the tiles of a field of view which are in the vision range
+ *
+ * \param radius : the vision range
+ * \return DiskMask*
+ */
+DiskMask* initDiskMask(int radius)
+{
+    DiskMask* mask = (DiskMask*)malloc(sizeof(DiskMask));
+    mask->radius = radius;
+    mask->size = radius*2 + 1;
+    mask->inside = (bool*)malloc(sizeof(bool) * mask->size * mask->size);
+
+    int radiusSquare = radius * radius;
+    int width, height;
+    for(height = 0; height < mask->size; height++)
+    {
+        for(width = 0; width < mask->size; width++)
+        {
+            int distanceSquare = (width - radius)*(width - radius) + (height - radius)*(height - radius);
+            mask->inside[height*mask->size + width] = distanceSquare < radiusSquare;
+        }
+    }
+
+    return mask;
+}
+
+/**
+ * \fn void destructDiskMask(DiskMask** mask)
+ * \brief function that free a disk mask out of memory
+ *
+ * \param mask : a double pointer on the disk mask
+ * \return void
+ */
+void destructDiskMask(DiskMask** mask)
+{
+    if(mask != NULL && *mask != NULL)
+    {
+        free((*mask)->inside);
+        free(*mask);
+        *mask = NULL;
+    }
+}
+
+/**
+ * \fn const DiskMask* getSharedDiskMask(int radius)
+ * \brief function that returns the disk mask shared by all the fields of view of the given vision range
+ * The mask is only computed again when the vision range changes
+ *
+ * \param radius : the vision range
+ * \return const DiskMask*
+ */
+const DiskMask* getSharedDiskMask(int radius)
+{
+    static DiskMask* sharedMask = NULL;
+    if(sharedMask == NULL || sharedMask->radius != radius)
     {
-        float x = xOrigin + i * vect[0];
-        float y = yOrigin + i * vect[1];
+        destructDiskMask(&sharedMask);
+        sharedMask = initDiskMask(radius);
+    }
+    return sharedMask;
+}
 
-        if ( ((int) x) != xPosition && ((int) y) != yPosition)
+/**
+ * \fn LineOfSightTable* initLineOfSightTable(int radius)
+ * \brief function that creates the table of the lines of sight from the center of a field of view to each of its tiles
+ *
+ * \param radius : the vision range of the field of view
+ * \return LineOfSightTable*
+ */
+LineOfSightTable* initLineOfSightTable(int radius)
+{
+    LineOfSightTable* table = (LineOfSightTable*)malloc(sizeof(LineOfSightTable));
+    table->radius = radius;
+    table->size = radius*2 + 1;
+    table->first = (int*)malloc(sizeof(int) * (table->size * table->size + 1));
+
+    //We count the tiles of each line first, to allocate all of them at once
+    int nbCells = 0;
+    int width, height;
+    for(height = 0; height < table->size; height++)
+    {
+        for(width = 0; width < table->size; width++)
+        {
+            table->first[height*table->size + width] = nbCells;
+            nbCells += getLineOfSight(radius, radius, width, height, NULL, NULL);
+        }
+    }
+    table->first[table->size * table->size] = nbCells;
+
+    table->xCells = (int*)malloc(sizeof(int) * (nbCells + 1));
+    table->yCells = (int*)malloc(sizeof(int) * (nbCells + 1));
+    for(height = 0; height < table->size; height++)
+    {
+        for(width = 0; width < table->size; width++)
+        {
+            int first = table->first[height*table->size + width];
+            getLineOfSight(radius, radius, width, height, table->xCells + first, table->yCells + first);
+        }
+    }
+
+    //We pack the tiles of each line in a mask of the square
+    table->nbWords = (table->size * table->size + 63) / 64;
+    table->blockers = (uint64_t*)calloc(table->size * table->size * table->nbWords, sizeof(uint64_t));
+    int target;
+    for(target = 0; target < table->size * table->size; target++)
+    {
+        uint64_t* blockers = table->blockers + target * table->nbWords;
+        int cell;
+        for(cell = table->first[target]; cell < table->first[target + 1]; cell++)
+        {
+            int bit = table->yCells[cell] * table->size + table->xCells[cell];
+            blockers[bit / 64] |= (uint64_t)1 << (bit % 64);
+        }
+    }
+
+    return table;
+}
+
+/**
+ * \fn void destructLineOfSightTable(LineOfSightTable** table)
+ * \brief function that free a table of lines of sight out of memory
+ *
+ * \param table : a double pointer on the table
+ * \return void
+ */
+void destructLineOfSightTable(LineOfSightTable** table)
+{
+    if(table != NULL && *table != NULL)
+    {
+        free((*table)->first);
+        free((*table)->xCells);
+        free((*table)->yCells);
+        free((*table)->blockers);
+        free(*table);
+        *table = NULL;
+    }
+}
+
+/**
+ * \fn const LineOfSightTable* getSharedLineOfSightTable(int radius)
+ * \brief function that returns the table of lines of sight shared by all the fields of view of the given vision range
+ * Each table is computed the first time its vision range is used, and then kept
+ *
+ * \param radius : the vision range
+ * \return const LineOfSightTable* : the table, NULL if the vision range is above LINE_OF_SIGHT_MAX_RADIUS
+ */
+const LineOfSightTable* getSharedLineOfSightTable(int radius)
+{
+    static LineOfSightTable* sharedTables[LINE_OF_SIGHT_MAX_RADIUS + 1] = {NULL};
+    if(radius < 0 || radius > LINE_OF_SIGHT_MAX_RADIUS)
+    {
+        return NULL;
+    }
+    if(sharedTables[radius] == NULL)
+    {
+        sharedTables[radius] = initLineOfSightTable(radius);
+    }
+    return sharedTables[radius];
+}
+
+/**
+ * \fn void setFieldView(FieldView* view, const Field* map, const DiskMask* mask, int x, int y)
+ * \brief function that places a field view on a map, centered on the given coordinates
+ * Nothing is copied or allocated : the view reads the tiles of the map directly.
+ * Like getFieldOfViewFromMap, the tiles on the first row and column of the map are left out
+ *
+ * \param view : the view to place
+ * \param map : the map that will be viewed
+ * \param mask : the disk mask of the vision range
+ * \param x, y : the coordinates in the map of the center of the view
+ * \return void
+ */
+void setFieldView(FieldView* view, const Field* map, const DiskMask* mask, int x, int y)
+{
+    view->map = map;
+    view->mask = mask;
+    view->width = mask->size;
+    view->height = mask->size;
+    view->xOrigin = x - mask->radius;
+    view->yOrigin = y - mask->radius;
+
+    //We keep the part of the view which is in the map
+    view->xMin = 1 - view->xOrigin;
+    view->xMax = map->width - 1 - view->xOrigin;
+    view->yMin = 1 - view->yOrigin;
+    view->yMax = map->height - 1 - view->yOrigin;
+    if(view->xMin < 0)
+    {
+        view->xMin = 0;
+    }
+    if(view->xMax > mask->size - 1)
+    {
+        view->xMax = mask->size - 1;
+    }
+    if(view->yMin < 0)
+    {
+        view->yMin = 0;
+    }
+    if(view->yMax > mask->size - 1)
+    {
+        view->yMax = mask->size - 1;
+    }
+}
+
+/**
+ * \fn bool isVisibleFromView(const FieldView* view, int xOrigin, int yOrigin, int xPosition, int yPosition)
+ * \brief function that returns true if a given position of a field view is visible from actual position
+ * Same as isVisibleFrom, on a field view
+ *
+ * \param view : a field view
+ * \param int xOrigin : x coordinate of actual position
+ * \param int yOrigin : y coordinate of actual position
+ * \param int xPosition : x coordinate we want to check
+ * \param int yPosition : y coordinate we want to check
+ * \return bool
+ */
+bool isVisibleFromView(const FieldView* view, int xOrigin, int yOrigin, int xPosition, int yPosition)
+{
+    const LineOfSightTable* table = getCenteredLineOfSightTable(view->width, view->height, xOrigin, yOrigin, xPosition, yPosition);
+    if(table != NULL)
+    {
+        int index = yPosition*table->size + xPosition;
+        int cell;
+        for(cell = table->first[index]; cell < table->first[index + 1]; cell++)
+        {
+            if(getFieldViewTile(view, table->xCells[cell], table->yCells[cell]) == WALL)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //We follow the line of sight from the origin when it isn't the center of the field view
+    return walkLineOfSight(NULL, view, xOrigin, yOrigin, xPosition, yPosition, NULL, NULL) != -1;
+}
+
+/**
+ * \fn int getVisibleMaskFromView(const FieldView* view, pointEnum tile, uint64_t* visible)
+ * \brief function that finds the tiles of a kind of a field view which are visible from its center (like isVisibleFromView).
+ * The WALLs of the view are packed in a mask, and a tile is visible if none of the tiles of its line of sight
+ * (see LineOfSightTable) is in this mask, so each tile costs a few AND on the words of the masks
+ *
+ * \param view : a field view
+ * \param tile : the kind of the tiles to find
+ * \param visible : array of at least LINE_OF_SIGHT_MAX_WORDS words, where the bit y*(2*radius + 1) + x is set
+ * if the tile (x, y) of the view is visible
+ * \return int : the number of visible tiles, -1 if the vision range of the view is above LINE_OF_SIGHT_MAX_RADIUS
+ */
+int getVisibleMaskFromView(const FieldView* view, pointEnum tile, uint64_t* visible)
+{
+    const LineOfSightTable* table = getSharedLineOfSightTable(view->mask->radius);
+    if(table == NULL)
+    {
+        return -1;
+    }
+
+    //We pack the WALLs and the tiles of the kind we look for
+    uint64_t walls[LINE_OF_SIGHT_MAX_WORDS];
+    int word;
+    for(word = 0; word < table->nbWords; word++)
+    {
+        walls[word] = 0;
+        visible[word] = 0;
+    }
+    int width, height;
+    for(height = view->yMin; height <= view->yMax; height++)
+    {
+        for(width = view->xMin; width <= view->xMax; width++)
+        {
+            int value = getFieldViewTile(view, width, height);
+            int bit = height * table->size + width;
+            if(value == WALL)
+            {
+                walls[bit / 64] |= (uint64_t)1 << (bit % 64);
+            }
+            if(value == (int)tile)
+            {
+                visible[bit / 64] |= (uint64_t)1 << (bit % 64);
+            }
+        }
+    }
+
+    //We remove the tiles whose line of sight goes through a WALL
+    int nbVisible = 0;
+    for(word = 0; word < table->nbWords; word++)
+    {
+        uint64_t candidates = visible[word];
+        while(candidates != 0)
         {
-            if (fieldOfView->data[(int) x][(int) y] == WALL)
+            int bit = word * 64 + __builtin_ctzll(candidates);
+            candidates &= candidates - 1;
+            const uint64_t* blockers = table->blockers + bit * table->nbWords;
+            int blockerWord;
+            for(blockerWord = 0; blockerWord < table->nbWords; blockerWord++)
             {
-                isVisible = false;
+                if((walls[blockerWord] & blockers[blockerWord]) != 0)
+                {
+                    visible[word] &= ~((uint64_t)1 << (bit % 64));
+                    break;
+                }
             }
         }
+        nbVisible += __builtin_popcountll(visible[word]);
     }
-    return isVisible;
+    return nbVisible;
 }
 
 /**
@@ -343,7 +857,7 @@ int getNbFog(Field* field)
             int height;
             for (height = 0; height < field->height; height++)
             {
-                if (field->data[width][height] == FOG)
+                if (getFieldTile(field, width, height) == FOG)
                     nbFog++;
             }
         }
@@ -21,15 +21,13 @@
 #include "BmpLib.h"
 #include "prototype.h"
 
-/**
- * \fn int **create2DIntArray(int width, int height)
- * \brief function that creates a 2 dimension array of int
- *
- * \param width : width of the array
- * \param height : height of the array
- * \return int** : A pointer to the created array
- */
-int **create2DIntArray(int width, int height);
+//The greatest vision range for which the lines of sight are kept in a table
+#ifndef LINE_OF_SIGHT_MAX_RADIUS
+    #define LINE_OF_SIGHT_MAX_RADIUS (32)
+#endif
+
+//The number of 64 bits words of a mask of the square of the greatest vision range
+#define LINE_OF_SIGHT_MAX_WORDS (((2*LINE_OF_SIGHT_MAX_RADIUS + 1)*(2*LINE_OF_SIGHT_MAX_RADIUS + 1) + 63) / 64)
 
 /**
  * \fn Field initialiseField(int width, int height, pointEnum defaultValue)
@@ -62,14 +60,14 @@ Field *createCustomField(char *pathImageField);
 void generateEnv(Field *oneField);
 
 /**
- * \fn void destruct2DIntArray(int **array, int width)
- * \brief function that free the 2D array out of memory
+ * \fn Field *allocateField(int width, int height)
+ * \brief function that allocates a field and its contiguous buffer of tiles, without initializing the tiles
  *
- * \param **array : The array to free
- * \param width : width of the array
- * \return void
+ * \param width : width of the field
+ * \param height : height of the field
+ * \return Field : Pointer to a Field, which is a tydef declared in core.h (2D array struct)
  */
-void destruct2DIntArray(int **array, int width);
+Field *allocateField(int width, int height);
 
 /**
  * \fn void destructField(Field **oneField)
@@ -103,6 +101,7 @@ Field* generateRandomFieldOfView(int visionRange, bool isValid);
 /**
  * \fn bool isVisibleFrom(Field* fieldOfView, int xOrigin, int yOrigin, int xPosition, int yPosition)
  * \brief function that returns true if a given position is visible from actual position
+ * When the actual position is the center of the field of view, the line of sight is read from the table of its vision range
  *
  * \param Field* fieldOfView : a field of view
  * \param int xOrigin : x coordinate of actual position
@@ -113,6 +112,120 @@ Field* generateRandomFieldOfView(int visionRange, bool isValid);
  */
 bool isVisibleFrom(Field* fieldOfView, int xOrigin, int yOrigin, int xPosition, int yPosition);
 
+/**
+ * \fn void castFieldOfView(const Field* theField, int xOrigin, int yOrigin, int radius, bool* visible)
+ * \brief function that finds the tiles of a field visible from a position, with a symmetric shadowcasting :
+ * each quarter of the vision is scanned row after row away from the position, and the parts of the rows hidden
+ * by the WALLs are removed from the next rows. Only integers are used, and each tile is read once per quarter.
+ * A tile is visible from a position if and only if the position is visible from the tile
+ *
+ * \param theField : the field
+ * \param xOrigin, yOrigin : the coordinate of the position, inside the field
+ * \param radius : the vision range, only the tiles at a distance lower than it are visible (like in a DiskMask)
+ * \param visible : array of (2*radius + 1)*(2*radius + 1) booleans, set to whether the tile (xOrigin + dx, yOrigin + dy)
+ * is visible at the index (dy + radius)*(2*radius + 1) + dx + radius. The tiles outside of the field are not visible
+ * \return void
+ */
+void castFieldOfView(const Field* theField, int xOrigin, int yOrigin, int radius, bool* visible);
+
+/**
+ * \fn DiskMask* initDiskMask(int radius)
+ * \brief function that creates the mask of the tiles of a field of view which are in the vision range
+ *
+ * \param radius : the vision range
+ * \return DiskMask*
+ */
+DiskMask* initDiskMask(int radius);
+
+/**
+ * \fn void destructDiskMask(DiskMask** mask)
+ * \brief function that free a disk mask out of memory
+ *
+ * \param mask : a double pointer on the disk mask
+ * \return void
+ */
+void destructDiskMask(DiskMask** mask);
+
+/**
+ * \fn const DiskMask* getSharedDiskMask(int radius)
+ * \brief function that returns the disk mask shared by all the fields of view of the given vision range
+ * The mask is only computed again when the vision range changes
+ *
+ * \param radius : the vision range
+ * \return const DiskMask*
+ */
+const DiskMask* getSharedDiskMask(int radius);
+
+/**
+ * \fn LineOfSightTable* initLineOfSightTable(int radius)
+ * \brief function that creates the table of the lines of sight from the center of a field of view to each of its tiles
+ *
+ * \param radius : the vision range of the field of view
+ * \return LineOfSightTable*
+ */
+LineOfSightTable* initLineOfSightTable(int radius);
+
+/**
+ * \fn void destructLineOfSightTable(LineOfSightTable** table)
+ * \brief function that free a table of lines of sight out of memory
+ *
+ * \param table : a double pointer on the table
+ * \return void
+ */
+void destructLineOfSightTable(LineOfSightTable** table);
+
+/**
+ * \fn const LineOfSightTable* getSharedLineOfSightTable(int radius)
+ * \brief function that returns the table of lines of sight shared by all the fields of view of the given vision range
+ * Each table is computed the first time its vision range is used, and then kept
+ *
+ * \param radius : the vision range
+ * \return const LineOfSightTable* : the table, NULL if the vision range is above LINE_OF_SIGHT_MAX_RADIUS
+ */
+const LineOfSightTable* getSharedLineOfSightTable(int radius);
+
+/**
+ * \fn void setFieldView(FieldView* view, const Field* map, const DiskMask* mask, int x, int y)
+ * \brief function that places a field view on a map, centered on the given coordinates
+ * Nothing is copied or allocated : the view reads the tiles of the map directly.
+ * Like getFieldOfViewFromMap, the tiles on the first row and column of the map are left out
+ *
+ * \param view : the view to place
+ * \param map : the map that will be viewed
+ * \param mask : the disk mask of the vision range
+ * \param x, y : the coordinates in the map of the center of the view
+ * \return void
+ */
+void setFieldView(FieldView* view, const Field* map, const DiskMask* mask, int x, int y);
+
+/**
+ * \fn bool isVisibleFromView(const FieldView* view, int xOrigin, int yOrigin, int xPosition, int yPosition)
+ * \brief function that returns true if a given position of a field view is visible from actual position
+ * Same as isVisibleFrom, on a field view
+ *
+ * \param view : a field view
+ * \param int xOrigin : x coordinate of actual position
+ * \param int yOrigin : y coordinate of actual position
+ * \param int xPosition : x coordinate we want to check
+ * \param int yPosition : y coordinate we want to check
+ * \return bool
+ */
+bool isVisibleFromView(const FieldView* view, int xOrigin, int yOrigin, int xPosition, int yPosition);
+
+/**
+ * \fn int getVisibleMaskFromView(const FieldView* view, pointEnum tile, uint64_t* visible)
+ * \brief function that finds the tiles of a kind of a field view which are visible from its center (like isVisibleFromView).
+ * The WALLs of the view are packed in a mask, and a tile is visible if none of the tiles of its line of sight
+ * (see LineOfSightTable) is in this mask, so each tile costs a few AND on the words of the masks
+ *
+ * \param view : a field view
+ * \param tile : the kind of the tiles to find
+ * \param visible : array of at least LINE_OF_SIGHT_MAX_WORDS words, where the bit y*(2*radius + 1) + x is set
+ * if the tile (x, y) of the view is visible
+ * \return int : the number of visible tiles, -1 if the vision range of the view is above LINE_OF_SIGHT_MAX_RADIUS
+ */
+int getVisibleMaskFromView(const FieldView* view, pointEnum tile, uint64_t* visible);
+
 /**
  * \fn int getNbFog(Field* field)
  * \brief function that returns the number of fog tile in a field
@@ -33,11 +33,13 @@ int drawField(SDL_Renderer *renderer, Field *oneField, int size)
 
     SDL_Rect square = {0, 0, 0, 0};
 
-    for(w = 0; w < oneField->width; w++)
+    //We go through the tiles in the order they are stored
+    for(h = 0; h < oneField->height; h++)
     {
-        for(h = 0; h < oneField->height; h++)
+        fieldTile *row = getFieldRow(oneField, h);
+        for(w = 0; w < oneField->width; w++)
         {
-            switch(oneField->data[w][h])
+            switch(row[w])
             {
                 case WALL:
                     //Set black color
@@ -139,55 +141,60 @@ int drawFieldOfViewEntity(SDL_Renderer *renderer, Entity *oneEntity, Field *theF
         }
     }
 
-    for(w = 0; w < 2*oneEntity->visionRange; w++)
+    //We go through the tiles of the field of view in the order they are stored
+    int nbTiles = oneEntity->fieldOfView->width * oneEntity->fieldOfView->height;
+    int index;
+    for(index = 0; index < nbTiles; index++)
     {
-        for(h = 0; h < 2*oneEntity->visionRange; h++)
+        int x, y;
+        int pointValue = getFieldOfViewTileEntity(oneEntity, index, &x, &y);
+        w = x - oneEntity->xFieldOfView;
+        h = y - oneEntity->yFieldOfView;
+
+        switch(pointValue)
         {
-            switch(oneEntity->fieldOfView[w][h].pointValue)
-            {
-                case WALL:
-                    //Set black color
-                    if(SDL_SetRenderDrawColor(renderer, wallColor.r, wallColor.g, wallColor.b, wallColor.a) < 0)
-                    {
-                        return -1;
-                    }
-                break;
+            case WALL:
+                //Set black color
+                if(SDL_SetRenderDrawColor(renderer, wallColor.r, wallColor.g, wallColor.b, wallColor.a) < 0)
+                {
+                    return -1;
+                }
+            break;
+        
+            case EMPTY:
+                //Set white color
+                if(SDL_SetRenderDrawColor(renderer, emptyColor.r, emptyColor.g, emptyColor.b, emptyColor.a) < 0)
+                {
+                    return -1;
+                }
+            break;
+
+            case FOG:
+                //Set fog color
+                if(SDL_SetRenderDrawColor(renderer, fogColor.r, fogColor.g, fogColor.b, fogColor.a) < 0)
+                {
+                    return -1;
+                }
+            break;
             
-                case EMPTY:
-                    //Set white color
-                    if(SDL_SetRenderDrawColor(renderer, emptyColor.r, emptyColor.g, emptyColor.b, emptyColor.a) < 0)
-                    {
-                        return -1;
-                    }
-                break;
-
-                case FOG:
-                    //Set fog color
-                    if(SDL_SetRenderDrawColor(renderer, fogColor.r, fogColor.g, fogColor.b, fogColor.a) < 0)
-                    {
-                        return -1;
-                    }
-                break;
-                
-                default:
-                    //Set default color
-                    if(SDL_SetRenderDrawColor(renderer, defaultColor.r, defaultColor.g, defaultColor.b, defaultColor.a) < 0)
-                    {
-                        return -1;
-                    }
-                break;
-            }
+            default:
+                //Set default color
+                if(SDL_SetRenderDrawColor(renderer, defaultColor.r, defaultColor.g, defaultColor.b, defaultColor.a) < 0)
+                {
+                    return -1;
+                }
+            break;
+        }
 
-            square.x = size*(w+1) + ((theField->width) * size) + /*(offset)*/ 2*size;
-            square.y = size*(h+1);
-            square.h = size;
-            square.w = size;
+        square.x = size*(w+1) + ((theField->width) * size) + /*(offset)*/ 2*size;
+        square.y = size*(h+1);
+        square.h = size;
+        square.w = size;
 
-            //We draw a square at the same position.
-            if(SDL_RenderFillRect(renderer, &square) < 0)
-            {
+        //We draw a square at the same position.
+        if(SDL_RenderFillRect(renderer, &square) < 0)
+        {
 		        return -1;
-            }
         }
     }
 
@@ -0,0 +1,473 @@
+/**
+ * \file distanceCache.c
+ * \brief The cache of the distances to a goal
+ * \version 0.1
+ * \date 17/10/2026
+ *
+ * Module that keeps, for a field that doesn't change and a goal, the number of steps from each tile to the goal.
+ * The distances are computed once with a breadth first search from the goal, and then a shortest path from any
+ * tile to the goal is read by going down the distances, in a number of steps equal to its length.
+ * The fields are identified by the value of their tiles, so a field changed in place is not mistaken for the old one.
+ * This key is computed by the users of the cache once per field, not at each search. The distances can be saved
+ * in a file next to the image of the field to be used again by the next runs.
+ *
+ */
+
+//Header files containing the prototypes
+#include "distanceCache.h"
+
+//The first bytes of a file of distance fields, followed by the version of its format
+static const char distanceFileTag[4] = {'M', 'M', 'D', 'F'};
+static const int32_t distanceFileVersion = 1;
+
+/**
+ * \fn DistanceCache* initDistanceCache(int capacity)
+ * \brief function that creates an empty cache of distance fields
+ *
+ * \param capacity : the number of distance fields kept by the cache
+ * \return DistanceCache*
+ */
+DistanceCache* initDistanceCache(int capacity)
+{
+    DistanceCache* cache = malloc(sizeof(DistanceCache));
+    cache->nbFields = 0;
+    cache->capacity = capacity;
+    cache->fields = malloc(sizeof(DistanceField*) * capacity);
+    return cache;
+}
+
+/**
+ * \fn static void destructDistanceField(DistanceField** distanceField)
+ * \brief function that free a distance field out of memory
+ *
+ * \param distanceField : a double pointer on the distance field
+ * \return void
+ */
+static void destructDistanceField(DistanceField** distanceField)
+{
+    if(distanceField != NULL)
+    {
+        if(*distanceField != NULL)
+        {
+            free((*distanceField)->distance);
+            free(*distanceField);
+            *distanceField = NULL;
+        }
+    }
+}
+
+/**
+ * \fn void destructDistanceCache(DistanceCache** cache)
+ * \brief function that free a cache and all its distance fields out of memory
+ *
+ * \param cache : a double pointer on the cache
+ * \return void
+ */
+void destructDistanceCache(DistanceCache** cache)
+{
+    if(cache != NULL)
+    {
+        if(*cache != NULL)
+        {
+            int index;
+            for(index = 0; index < (*cache)->nbFields; index++)
+            {
+                destructDistanceField(&((*cache)->fields[index]));
+            }
+            free((*cache)->fields);
+            free(*cache);
+            *cache = NULL;
+        }
+    }
+}
+
+/**
+ * \fn DistanceCache* getSharedDistanceCache(void)
+ * \brief function that returns the cache shared by all the searches on the complete fields, of capacity DISTANCE_CACHE_CAPACITY
+ * It must only be used by one thread
+ *
+ * \return DistanceCache*
+ */
+DistanceCache* getSharedDistanceCache(void)
+{
+    static DistanceCache* sharedCache = NULL;
+    if(sharedCache == NULL)
+    {
+        sharedCache = initDistanceCache(DISTANCE_CACHE_CAPACITY);
+    }
+    return sharedCache;
+}
+
+/**
+ * \fn uint64_t getFieldKey(const Field* theField)
+ * \brief function that returns a key computed from the dimension and the tiles of a field (FNV-1a hash)
+ * Two fields with the same key are considered to be the same field
+ *
+ * \param theField : the field
+ * \return uint64_t
+ */
+uint64_t getFieldKey(const Field* theField)
+{
+    uint64_t key = 14695981039346656037ULL;
+    const uint64_t prime = 1099511628211ULL;
+    key = (key ^ (uint64_t)theField->width) * prime;
+    key = (key ^ (uint64_t)theField->height) * prime;
+    int y;
+    for(y = 0; y < theField->height; y++)
+    {
+        //Only the tiles of the row are read, not the padding at its end
+        const unsigned char* row = (const unsigned char*)(theField->data + y * theField->stride);
+        size_t byte;
+        for(byte = 0; byte < sizeof(fieldTile) * theField->width; byte++)
+        {
+            key = (key ^ row[byte]) * prime;
+        }
+    }
+    return key;
+}
+
+/**
+ * \fn static DistanceField* computeDistanceField(const Field* theField, uint64_t fieldKey, int xGoal, int yGoal)
+ * \brief function that computes the distances of the tiles of a field to a goal with a breadth first search from the goal
+ * through the empty and visited tiles, like the paths of the A* algorithme
+ *
+ * \param theField : the field
+ * \param fieldKey : the key of the field
+ * \param xGoal, yGoal : the coordinate of the goal
+ * \return DistanceField*
+ */
+static DistanceField* computeDistanceField(const Field* theField, uint64_t fieldKey, int xGoal, int yGoal)
+{
+    //The neighbors are visited in the same order as addNeighbors : left, right, up, down
+    const int xOffsets[4] = {-1, 1, 0, 0};
+    const int yOffsets[4] = {0, 0, -1, 1};
+    int width = theField->width;
+    int nbTiles = width * theField->height;
+    DistanceField* distanceField = malloc(sizeof(DistanceField));
+    distanceField->width = width;
+    distanceField->height = theField->height;
+    distanceField->fieldKey = fieldKey;
+    distanceField->xGoal = xGoal;
+    distanceField->yGoal = yGoal;
+    distanceField->distance = malloc(sizeof(int) * nbTiles);
+
+    int tile;
+    for(tile = 0; tile < nbTiles; tile++)
+    {
+        distanceField->distance[tile] = INFINITE_DISTANCE;
+    }
+    //Like with the A* algorithme, a path can only end on an empty or visited goal
+    if(!isWalkableTile(theField, xGoal, yGoal))
+    {
+        return distanceField;
+    }
+
+    int* queue = malloc(sizeof(int) * nbTiles);
+    int first = 0;
+    int last = 0;
+    distanceField->distance[yGoal * width + xGoal] = 0;
+    queue[last++] = yGoal * width + xGoal;
+    while(first < last)
+    {
+        int currentTile = queue[first++];
+        int direction;
+        for(direction = 0; direction < 4; direction++)
+        {
+            int x = currentTile % width + xOffsets[direction];
+            int y = currentTile / width + yOffsets[direction];
+            if(isWalkableTile(theField, x, y) && distanceField->distance[y * width + x] == INFINITE_DISTANCE)
+            {
+                distanceField->distance[y * width + x] = distanceField->distance[currentTile] + 1;
+                queue[last++] = y * width + x;
+            }
+        }
+    }
+    free(queue);
+    return distanceField;
+}
+
+/**
+ * \fn static void addDistanceField(DistanceCache* cache, DistanceField* distanceField)
+ * \brief function that adds a distance field at the front of a cache, and forgets the least recently used one if the cache is full
+ *
+ * \param cache : the cache
+ * \param distanceField : the distance field, which then belongs to the cache
+ * \return void
+ */
+static void addDistanceField(DistanceCache* cache, DistanceField* distanceField)
+{
+    if(cache->nbFields == cache->capacity)
+    {
+        cache->nbFields--;
+        destructDistanceField(&(cache->fields[cache->nbFields]));
+    }
+    memmove(&(cache->fields[1]), &(cache->fields[0]), sizeof(DistanceField*) * cache->nbFields);
+    cache->fields[0] = distanceField;
+    cache->nbFields++;
+}
+
+/**
+ * \fn static int findDistanceField(const DistanceCache* cache, uint64_t fieldKey, int width, int height, int xGoal, int yGoal)
+ * \brief function that returns the index of a distance field in a cache
+ *
+ * \param cache : the cache
+ * \param fieldKey : the key of the field
+ * \param width, height : the dimension of the field
+ * \param xGoal, yGoal : the coordinate of the goal
+ * \return int : the index, -1 if the cache doesn't have this distance field
+ */
+static int findDistanceField(const DistanceCache* cache, uint64_t fieldKey, int width, int height, int xGoal, int yGoal)
+{
+    int index;
+    for(index = 0; index < cache->nbFields; index++)
+    {
+        const DistanceField* distanceField = cache->fields[index];
+        if(distanceField->fieldKey == fieldKey && distanceField->width == width && distanceField->height == height &&
+           distanceField->xGoal == xGoal && distanceField->yGoal == yGoal)
+        {
+            return index;
+        }
+    }
+    return -1;
+}
+
+/**
+ * \fn const DistanceField* getDistanceField(DistanceCache* cache, const Field* theField, uint64_t fieldKey, int xGoal, int yGoal)
+ * \brief function that returns the distances of the tiles of a field to a goal, from the cache if they were already computed
+ * The distances are the ones of the paths of the A* algorithme, which only go through empty and visited tiles
+ *
+ * \param cache : the cache
+ * \param theField : the field, which must not change while the distance field is used
+ * \param fieldKey : the key of the field (see getFieldKey). It goes through all the tiles, so it is computed
+ * by the caller once for as long as the field doesn't change
+ * \param xGoal, yGoal : the coordinate of the goal
+ * \return const DistanceField* : the distances, which belong to the cache and are kept until they are forgotten by it
+ */
+const DistanceField* getDistanceField(DistanceCache* cache, const Field* theField, uint64_t fieldKey, int xGoal, int yGoal)
+{
+    int index = findDistanceField(cache, fieldKey, theField->width, theField->height, xGoal, yGoal);
+    if(index == -1)
+    {
+        addDistanceField(cache, computeDistanceField(theField, fieldKey, xGoal, yGoal));
+    }
+    else if(index > 0)
+    {
+        //We move the distance field to the front, as the most recently used one
+        DistanceField* distanceField = cache->fields[index];
+        memmove(&(cache->fields[1]), &(cache->fields[0]), sizeof(DistanceField*) * index);
+        cache->fields[0] = distanceField;
+    }
+    return cache->fields[0];
+}
+
+/**
+ * \fn static int getNextTileDistanceField(const DistanceField* distanceField, int tile)
+ * \brief function that returns the neighbor of a tile the nearest from the goal
+ * The neighbors are tried in the same order as addNeighbors : left, right, up and down
+ *
+ * \param distanceField : the distances to the goal
+ * \param tile : the index of the tile
+ * \return int : the index of the neighbor, -1 if the goal can't be reached from any neighbor
+ */
+static int getNextTileDistanceField(const DistanceField* distanceField, int tile)
+{
+    const int* distance = distanceField->distance;
+    int width = distanceField->width;
+    int x = tile % width;
+    int y = tile / width;
+    int next = -1;
+    int nextDistance = INFINITE_DISTANCE;
+    if(x > 0 && distance[tile - 1] < nextDistance)
+    {
+        next = tile - 1;
+        nextDistance = distance[next];
+    }
+    if(x < width - 1 && distance[tile + 1] < nextDistance)
+    {
+        next = tile + 1;
+        nextDistance = distance[next];
+    }
+    if(y > 0 && distance[tile - width] < nextDistance)
+    {
+        next = tile - width;
+        nextDistance = distance[next];
+    }
+    if(y < distanceField->height - 1 && distance[tile + width] < nextDistance)
+    {
+        next = tile + width;
+    }
+    return next;
+}
+
+/**
+ * \fn node* findPathFromDistanceField(const DistanceField* distanceField, node* startNode)
+ * \brief function that returns a shortest path from a starting node to the goal of a distance field,
+ * by going down the distances. Like the A* algorithme, the starting node can be a wall
+ *
+ * \param distanceField : the distances to the goal
+ * \param startNode : the starting node of the path
+ * \return node* : the path, startNode if the goal can't be reached
+ */
+node* findPathFromDistanceField(const DistanceField* distanceField, node* startNode)
+{
+    int width = distanceField->width;
+    int tile = startNode->y * width + startNode->x;
+    int goalTile = distanceField->yGoal * width + distanceField->xGoal;
+    //The length of the path, which is one more than the distance of the first tile after the start when the start is a wall
+    int length = distanceField->distance[tile];
+    if(tile != goalTile && length == INFINITE_DISTANCE)
+    {
+        int next = getNextTileDistanceField(distanceField, tile);
+        if(next == -1)
+        {
+            //We return just the starting node, which means their is no path
+            return startNode;
+        }
+        length = distanceField->distance[next] + 1;
+    }
+
+    node* path = initNode(startNode->x, startNode->y, 0, length);
+    node* lastNode = path;
+    while(tile != goalTile)
+    {
+        tile = getNextTileDistanceField(distanceField, tile);
+        lastNode->linkedNode = initNode(tile % width, tile / width, lastNode->cost + 1, length);
+        lastNode = lastNode->linkedNode;
+    }
+    return path;
+}
+
+/**
+ * \fn bool saveDistanceFields(const DistanceCache* cache, const Field* theField, const char* path)
+ * \brief function that saves in a file the distance fields of the cache computed on a field
+ * Nothing is written if there is none
+ *
+ * \param cache : the cache
+ * \param theField : the field whose distance fields are saved
+ * \param path : the path of the file
+ * \return bool : false if the file couldn't be written
+ */
+bool saveDistanceFields(const DistanceCache* cache, const Field* theField, const char* path)
+{
+    uint64_t fieldKey = getFieldKey(theField);
+    int32_t nbFields = 0;
+    int index;
+    for(index = 0; index < cache->nbFields; index++)
+    {
+        if(cache->fields[index]->fieldKey == fieldKey)
+        {
+            nbFields++;
+        }
+    }
+    if(nbFields == 0)
+    {
+        return true;
+    }
+
+    FILE* file = fopen(path, "wb");
+    if(file == NULL)
+    {
+        return false;
+    }
+    bool isWritten = fwrite(distanceFileTag, sizeof(distanceFileTag), 1, file) == 1 &&
+                     fwrite(&distanceFileVersion, sizeof(int32_t), 1, file) == 1 &&
+                     fwrite(&nbFields, sizeof(int32_t), 1, file) == 1;
+    for(index = 0; index < cache->nbFields && isWritten; index++)
+    {
+        const DistanceField* distanceField = cache->fields[index];
+        if(distanceField->fieldKey == fieldKey)
+        {
+            int32_t header[4] = {distanceField->width, distanceField->height, distanceField->xGoal, distanceField->yGoal};
+            size_t nbTiles = (size_t)distanceField->width * distanceField->height;
+            isWritten = fwrite(header, sizeof(int32_t), 4, file) == 4 &&
+                        fwrite(&(distanceField->fieldKey), sizeof(uint64_t), 1, file) == 1 &&
+                        fwrite(distanceField->distance, sizeof(int), nbTiles, file) == nbTiles;
+        }
+    }
+    //The file is closed even if it couldn't be written
+    isWritten = fclose(file) == 0 && isWritten;
+    return isWritten;
+}
+
+/**
+ * \fn int loadDistanceFields(DistanceCache* cache, const Field* theField, const char* path)
+ * \brief function that adds to the cache the distance fields of a file which were computed on a field
+ * The distance fields of other fields, or of an older version of the field, are skipped
+ *
+ * \param cache : the cache
+ * \param theField : the field
+ * \param path : the path of the file
+ * \return int : the number of distance fields added, -1 if the file couldn't be read
+ */
+int loadDistanceFields(DistanceCache* cache, const Field* theField, const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if(file == NULL)
+    {
+        return -1;
+    }
+    char tag[4];
+    int32_t version = 0;
+    int32_t nbFields = 0;
+    if(fread(tag, sizeof(tag), 1, file) != 1 || memcmp(tag, distanceFileTag, sizeof(tag)) != 0 ||
+       fread(&version, sizeof(int32_t), 1, file) != 1 || version != distanceFileVersion ||
+       fread(&nbFields, sizeof(int32_t), 1, file) != 1)
+    {
+        fclose(file);
+        return -1;
+    }
+
+    uint64_t fieldKey = getFieldKey(theField);
+    size_t nbTiles = (size_t)theField->width * theField->height;
+    int nbLoaded = 0;
+    int index;
+    for(index = 0; index < nbFields; index++)
+    {
+        int32_t header[4];
+        uint64_t key;
+        if(fread(header, sizeof(int32_t), 4, file) != 4 || fread(&key, sizeof(uint64_t), 1, file) != 1)
+        {
+            break;
+        }
+        if(key != fieldKey || header[0] != theField->width || header[1] != theField->height)
+        {
+            //The distances were computed on another field, we skip them
+            if(header[0] <= 0 || header[1] <= 0 ||
+               fseek(file, (long)sizeof(int) * header[0] * header[1], SEEK_CUR) != 0)
+            {
+                break;
+            }
+        }
+        else if(header[2] < 0 || header[2] >= theField->width || header[3] < 0 || header[3] >= theField->height)
+        {
+            //The goal is outside of the field, the file is damaged
+            break;
+        }
+        else
+        {
+            DistanceField* distanceField = malloc(sizeof(DistanceField));
+            distanceField->width = header[0];
+            distanceField->height = header[1];
+            distanceField->xGoal = header[2];
+            distanceField->yGoal = header[3];
+            distanceField->fieldKey = key;
+            distanceField->distance = malloc(sizeof(int) * nbTiles);
+            if(fread(distanceField->distance, sizeof(int), nbTiles, file) != nbTiles)
+            {
+                destructDistanceField(&distanceField);
+                break;
+            }
+            if(findDistanceField(cache, key, header[0], header[1], header[2], header[3]) == -1)
+            {
+                addDistanceField(cache, distanceField);
+                nbLoaded++;
+            }
+            else
+            {
+                destructDistanceField(&distanceField);
+            }
+        }
+    }
+    fclose(file);
+    return nbLoaded;
+}
@@ -0,0 +1,141 @@
+/**
+ * \file distanceCache.h
+ * \brief Prototypes of the cache of the distances to a goal
+ * \version 0.1
+ * \date 17/10/2026
+ *
+ * Module that keeps, for a field that doesn't change and a goal, the number of steps from each tile to the goal.
+ * The distances are computed once with a breadth first search from the goal, and then a shortest path from any
+ * tile to the goal is read by going down the distances, in a number of steps equal to its length.
+ * The fields are identified by the value of their tiles, so a field changed in place is not mistaken for the old one.
+ * This key is computed by the users of the cache once per field, not at each search. The distances can be saved
+ * in a file next to the image of the field to be used again by the next runs.
+ *
+ */
+
+#ifndef H_DISTANCECACHE
+    #define H_DISTANCECACHE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "prototype.h"
+#include "pathfinding.h"
+
+//The number of distance fields kept by a cache, the least recently used one is forgotten first
+#ifndef DISTANCE_CACHE_CAPACITY
+    #define DISTANCE_CACHE_CAPACITY (16)
+#endif
+
+//The extension added to the path of the image of a field to name the file of its distances
+#define DISTANCE_FILE_EXTENSION ".dist"
+
+//The number of steps from each tile of a field to a goal
+typedef struct DistanceField
+{
+    int width;
+    int height;
+    //The key of the field (see getFieldKey) and the goal
+    uint64_t fieldKey;
+    int xGoal, yGoal;
+    //The distance of each tile to the goal, row by row (INFINITE_DISTANCE if the goal can't be reached from it)
+    int* distance;
+} DistanceField;
+
+//The distance fields already computed, from the most recently used to the least
+typedef struct DistanceCache
+{
+    int nbFields;
+    int capacity;
+    DistanceField** fields;
+} DistanceCache;
+
+/**
+ * \fn DistanceCache* initDistanceCache(int capacity)
+ * \brief function that creates an empty cache of distance fields
+ *
+ * \param capacity : the number of distance fields kept by the cache
+ * \return DistanceCache*
+ */
+DistanceCache* initDistanceCache(int capacity);
+
+/**
+ * \fn void destructDistanceCache(DistanceCache** cache)
+ * \brief function that free a cache and all its distance fields out of memory
+ *
+ * \param cache : a double pointer on the cache
+ * \return void
+ */
+void destructDistanceCache(DistanceCache** cache);
+
+/**
+ * \fn DistanceCache* getSharedDistanceCache(void)
+ * \brief function that returns the cache shared by all the searches on the complete fields, of capacity DISTANCE_CACHE_CAPACITY
+ * It must only be used by one thread
+ *
+ * \return DistanceCache*
+ */
+DistanceCache* getSharedDistanceCache(void);
+
+/**
+ * \fn uint64_t getFieldKey(const Field* theField)
+ * \brief function that returns a key computed from the dimension and the tiles of a field (FNV-1a hash)
+ * Two fields with the same key are considered to be the same field
+ *
+ * \param theField : the field
+ * \return uint64_t
+ */
+uint64_t getFieldKey(const Field* theField);
+
+/**
+ * \fn const DistanceField* getDistanceField(DistanceCache* cache, const Field* theField, uint64_t fieldKey, int xGoal, int yGoal)
+ * \brief function that returns the distances of the tiles of a field to a goal, from the cache if they were already computed
+ * The distances are the ones of the paths of the A* algorithme, which only go through empty and visited tiles
+ *
+ * \param cache : the cache
+ * \param theField : the field, which must not change while the distance field is used
+ * \param fieldKey : the key of the field (see getFieldKey). It goes through all the tiles, so it is computed
+ * by the caller once for as long as the field doesn't change
+ * \param xGoal, yGoal : the coordinate of the goal
+ * \return const DistanceField* : the distances, which belong to the cache and are kept until they are forgotten by it
+ */
+const DistanceField* getDistanceField(DistanceCache* cache, const Field* theField, uint64_t fieldKey, int xGoal, int yGoal);
+
+/**
+ * \fn node* findPathFromDistanceField(const DistanceField* distanceField, node* startNode)
+ * \brief function that returns a shortest path from a starting node to the goal of a distance field,
+ * by going down the distances. Like the A* algorithme, the starting node can be a wall
+ *
+ * \param distanceField : the distances to the goal
+ * \param startNode : the starting node of the path
+ * \return node* : the path, startNode if the goal can't be reached
+ */
+node* findPathFromDistanceField(const DistanceField* distanceField, node* startNode);
+
+/**
+ * \fn bool saveDistanceFields(const DistanceCache* cache, const Field* theField, const char* path)
+ * \brief function that saves in a file the distance fields of the cache computed on a field
+ * Nothing is written if there is none
+ *
+ * \param cache : the cache
+ * \param theField : the field whose distance fields are saved
+ * \param path : the path of the file
+ * \return bool : false if the file couldn't be written
+ */
+bool saveDistanceFields(const DistanceCache* cache, const Field* theField, const char* path);
+
+/**
+ * \fn int loadDistanceFields(DistanceCache* cache, const Field* theField, const char* path)
+ * \brief function that adds to the cache the distance fields of a file which were computed on a field
+ * The distance fields of other fields, or of an older version of the field, are skipped
+ *
+ * \param cache : the cache
+ * \param theField : the field
+ * \param path : the path of the file
+ * \return int : the number of distance fields added, -1 if the file couldn't be read
+ */
+int loadDistanceFields(DistanceCache* cache, const Field* theField, const char* path);
+
+#endif
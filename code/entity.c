@@ -12,6 +12,67 @@
 //Header files containing the prototypes
 #include "entity.h"
 
+/**
+ * \fn static void clearDirtyRegionEntity(Entity *entity)
+ * \brief function that empties the bounding box of the changed tiles of the mental map of an entity
+ *
+ * \param entity : the entity
+ * \return void
+ */
+static void clearDirtyRegionEntity(Entity *entity)
+{
+    entity->xDirtyMin = entity->mentalMap->width;
+    entity->xDirtyMax = -1;
+    entity->yDirtyMin = entity->mentalMap->height;
+    entity->yDirtyMax = -1;
+}
+
+/**
+ * \fn static void addDirtyTileEntity(Entity *entity, int x, int y)
+ * \brief function that adds a changed tile of the mental map of an entity to the bounding box of the changed tiles,
+ * and tells it to the planner, the clusters, the landmarks and the index of the nearest walkable tiles of the entity
+ *
+ * \param entity : the entity
+ * \param x, y : the coordinates of the changed tile
+ * \return void
+ */
+static void addDirtyTileEntity(Entity *entity, int x, int y)
+{
+    //The planner, the clusters, the landmarks and the index are only created when they are used
+    if(entity->planner != NULL)
+    {
+        updateTileIncrementalPlanner(entity->planner, x, y);
+    }
+    if(entity->clusterGraph != NULL)
+    {
+        updateTileClusterGraph(entity->clusterGraph, x, y);
+    }
+    if(entity->landmarks != NULL)
+    {
+        updateTileLandmarks(entity->landmarks, x, y);
+    }
+    if(entity->nearestIndex != NULL)
+    {
+        updateTileNearestIndex(entity->nearestIndex, x, y);
+    }
+    if(x < entity->xDirtyMin)
+    {
+        entity->xDirtyMin = x;
+    }
+    if(x > entity->xDirtyMax)
+    {
+        entity->xDirtyMax = x;
+    }
+    if(y < entity->yDirtyMin)
+    {
+        entity->yDirtyMin = y;
+    }
+    if(y > entity->yDirtyMax)
+    {
+        entity->yDirtyMax = y;
+    }
+}
+
 /**
  * \fn Entity* initialiseEntity(int x, int y, int visionRange, int fieldWidth, int fieldHeight)
  * \brief function that initialise an Entity. An Entity is used by the neural network to navigate in a Field
@@ -30,6 +91,22 @@ Entity* initialiseEntity(int x, int y, int visionRange, int fieldWidth, int fiel
     
     initialiseFieldOfViewEntity(entity);
     initializeMentalMapEntity(entity, fieldWidth, fieldHeight);
+
+    entity->interestField = initialiseInterestField(fieldWidth, fieldHeight);
+    entity->interestCache = (InterestCache*)malloc(sizeof(InterestCache));
+    entity->interestCache->labeling = (double*)malloc(sizeof(double) * fieldWidth * fieldHeight);
+    //Nothing has been computed yet
+    entity->interestCache->isValid = false;
+    clearDirtyRegionEntity(entity);
+    entity->interestRanking = initInterestRanking(fieldWidth * fieldHeight);
+    //The planner is only created when INCREMENTAL_SEARCH uses it
+    entity->planner = NULL;
+    //The clusters are only created when HIERARCHICAL_SEARCH uses them
+    entity->clusterGraph = NULL;
+    //The landmarks are only created when LANDMARK_HEURISTIC uses them
+    entity->landmarks = NULL;
+    //The index is only created when findNextPathNN2 uses it
+    entity->nearestIndex = NULL;
     return entity;
 }
 
@@ -56,28 +133,20 @@ void initializeMentalMapEntity(Entity *entity, int width, int height)
  */
 void initialiseFieldOfViewEntity(Entity *entity)
 {
-    int i;
-    int j;
     int diameter = (2*entity->visionRange + 1);
 
-    entity->fieldOfView = NULL;
-
-    entity->fieldOfView = (Point**)malloc(sizeof(Point*) * diameter);
-
-    for(i = 0; i < diameter; i++)
-    {
-        entity->fieldOfView[i] = (Point*)malloc(sizeof(Point) * diameter);
-    }
-
-    for(i = 0; i < diameter; i++)
-    {
-        for(j = 0; j < diameter; j++)
-        {
-            entity->fieldOfView[j][i].x = j;
-            entity->fieldOfView[j][i].y = i;
-            entity->fieldOfView[j][i].pointValue = FOG;
-        }
-    }
+    entity->fieldOfView = initialiseField(diameter, diameter, FOG);
+    entity->xFieldOfView = entity->x - entity->visionRange;
+    entity->yFieldOfView = entity->y - entity->visionRange;
+    entity->visibility = (bool*)malloc(sizeof(bool) * diameter * diameter);
+
+    entity->visibleTiles = (int*)malloc(sizeof(int) * diameter * diameter);
+    entity->nbVisibleTiles = 0;
+    entity->revealedTiles = (Point*)malloc(sizeof(Point) * diameter * diameter);
+    entity->nbRevealedTiles = 0;
+    //The position of the entity can be changed as well as all the tiles of the field of view
+    entity->changedTiles = (Point*)malloc(sizeof(Point) * (diameter * diameter + 1));
+    entity->nbChangedTiles = 0;
 }
 
 /**
@@ -91,6 +160,14 @@ void destructEntity(Entity** entity)
 {
     destructFieldOfViewEntity(*entity);
     destructField(&((*entity)->mentalMap));
+    destructInterestField(&((*entity)->interestField));
+    free((*entity)->interestCache->labeling);
+    free((*entity)->interestCache);
+    destructInterestRanking(&((*entity)->interestRanking));
+    destructIncrementalPlanner(&((*entity)->planner));
+    destructClusterGraph(&((*entity)->clusterGraph));
+    destructLandmarks(&((*entity)->landmarks));
+    destructNearestIndex(&((*entity)->nearestIndex));
 
     if(entity != NULL)
     {
@@ -111,18 +188,18 @@ void destructEntity(Entity** entity)
  */
 void destructFieldOfViewEntity(Entity *entity)
 {
-    int i;
-    int diameter = (2*entity->visionRange + 1);
-
     if(entity->fieldOfView != NULL)
     {
-        for(i = 0; i < diameter; i++)
-        {
-            free(entity->fieldOfView[i]);
-        }
-
-        free(entity->fieldOfView);
-        entity->fieldOfView = NULL;
+        destructField(&(entity->fieldOfView));
+        free(entity->visibility);
+        entity->visibility = NULL;
+
+        free(entity->visibleTiles);
+        entity->visibleTiles = NULL;
+        free(entity->revealedTiles);
+        entity->revealedTiles = NULL;
+        free(entity->changedTiles);
+        entity->changedTiles = NULL;
     }
 }
 
@@ -154,7 +231,8 @@ void showEntity(Entity* entity, SDL_Renderer* renderer, SDL_Color color, int til
 
 /**
  * \fn void updateMentalMapEntity(Entity *entity)
- * \brief function that update the mental map of an entity
+ * \brief function that update the mental map of an entity with the tiles revealed by the last update of its field of view,
+ * lists the tiles it changed in changedTiles, and then tells them to the modules which follow the mental map (see addDirtyTileEntity)
  *
  * \param entity : the Entity to update
  * \param stats : the structure we use to store statistics
@@ -162,41 +240,48 @@ void showEntity(Entity* entity, SDL_Renderer* renderer, SDL_Color color, int til
  */
 void updateMentalMapEntity(Entity *entity, Statistics *stats)
 {
-    int widthIndex, heightIndex;
-    for(widthIndex = 0; widthIndex < 2*entity->visionRange + 1; widthIndex++)
+    entity->nbChangedTiles = 0;
+
+    if(getFieldTile(entity->mentalMap, entity->x, entity->y) != VISITED)
     {
-        for(heightIndex = 0; heightIndex < 2*entity->visionRange + 1; heightIndex++)
+        setFieldTile(entity->mentalMap, entity->x, entity->y, VISITED);
+        entity->changedTiles[entity->nbChangedTiles] = (Point){entity->x, entity->y, VISITED};
+        entity->nbChangedTiles++;
+    }
+
+    //Only the tiles revealed by the field of view can change, the other ones are already known or still hidden
+    int index;
+    for(index = 0; index < entity->nbRevealedTiles; index++)
+    {
+        Point revealed = entity->revealedTiles[index];
+
+        //Check if the old value of the point was FOG before updating it
+        if(getFieldTile(entity->mentalMap, revealed.x, revealed.y) == FOG)
         {
-            int pointWidth = entity->fieldOfView[widthIndex][heightIndex].x;
-            int pointHeight = entity->fieldOfView[widthIndex][heightIndex].y;
-            pointEnum pointValue = entity->fieldOfView[widthIndex][heightIndex].pointValue;
+            setFieldTile(entity->mentalMap, revealed.x, revealed.y, revealed.pointValue);
+            entity->changedTiles[entity->nbChangedTiles] = revealed;
+            entity->nbChangedTiles++;
 
-            if(pointWidth >= 0 && pointWidth < entity->mentalMap->width && 
-                pointHeight >= 0 && pointHeight < entity->mentalMap->height)
+            //We store the number of fog tiles revealed
+            if(stats != NULL)
             {
-                pointEnum mentalMapPoint = entity->mentalMap->data[pointWidth][pointHeight];
-
-                //Check if the old value of the point was FOG before updating it
-                if(mentalMapPoint == FOG && pointValue != FOG)
-                {
-                    entity->mentalMap->data[pointWidth][pointHeight] = pointValue;
-                    
-                    //We store the number of fog tiles revealed
-                    if(stats != NULL)
-                    {
-                        stats->data[NB_FOG_REVEALED]++;
-                    }
-                }
-                
-                entity->mentalMap->data[entity->x][entity->y] = VISITED;
+                stats->data[NB_FOG_REVEALED]++;
             }
         }
     }
+
+    //The modules which follow the mental map are told about the changed tiles once they are all written
+    for(index = 0; index < entity->nbChangedTiles; index++)
+    {
+        addDirtyTileEntity(entity, entity->changedTiles[index].x, entity->changedTiles[index].y);
+    }
 }
 
 /**
  * \fn void updateFieldOfViewEntity(Field *aField, Entity *entity)
- * \brief function that update the field of view of an entity
+ * \brief function that update the field of view of an entity with the tiles of the field it can see in its vision range
+ * (see castFieldOfView). The tiles it can't see are FOG.
+ * The visible tiles which are FOG in the mental map are listed in revealedTiles
  *
  * \param entity : the Entity to update
  * \param field* : A pointer to the field on which we are based
@@ -204,58 +289,41 @@ void updateMentalMapEntity(Entity *entity, Statistics *stats)
  */
 void updateFieldOfViewEntity(Field *aField, Entity *entity)
 {
-    int i,j;
+    int diameter = 2*entity->visionRange + 1;
 
-    for(i = 0; i < (2*entity->visionRange + 1); i++)
+    //We hide again the tiles seen at the last update, the other ones are already FOG
+    int index;
+    for(index = 0; index < entity->nbVisibleTiles; index++)
     {
-        for(j = 0; j < (2*entity->visionRange + 1); j++)
-        {
-            entity->fieldOfView[j][i].x = j;
-            entity->fieldOfView[j][i].y = i;
-            entity->fieldOfView[j][i].pointValue = FOG;
-        }
+        setFieldTile(entity->fieldOfView, entity->visibleTiles[index] % diameter, entity->visibleTiles[index] / diameter, FOG);
     }
+    entity->nbVisibleTiles = 0;
+    entity->nbRevealedTiles = 0;
+    entity->xFieldOfView = entity->x - entity->visionRange;
+    entity->yFieldOfView = entity->y - entity->visionRange;
 
-    // ================
-
-    float angle;
-    float stepAngle = 0.1; //tan(1 / entity->visionRange);
-    float stepDistance = 0.4;
-    float distance;
-    bool aWall;
+    //The visible tiles are found with a shadowcasting, in a number of steps which only grows with the number of tiles
+    castFieldOfView(aField, entity->x, entity->y, entity->visionRange, entity->visibility);
 
-    for(angle = 0; angle < 2*M_PI; angle += stepAngle)
+    int widthFieldOfView, heightFieldOfView;
+    for(heightFieldOfView = 0; heightFieldOfView < diameter; heightFieldOfView++)
     {
-        aWall = false;
-
-        for(distance = 0; distance < entity->visionRange; distance += stepDistance)
+        for(widthFieldOfView = 0; widthFieldOfView < diameter; widthFieldOfView++)
         {
-            if(!aWall)
+            if(entity->visibility[heightFieldOfView * diameter + widthFieldOfView])
             {
-                float x = distance * cos(angle);
-                float y = distance * sin(angle);
-
-                if( ((entity->x + x) >= 0) && ((entity->x + x) < aField->width) && ((entity->y + y) >= 0) && ((entity->y + y) < aField->height) )
+                int x = entity->xFieldOfView + widthFieldOfView;
+                int y = entity->yFieldOfView + heightFieldOfView;
+                pointEnum pointValue = getFieldTile(aField, x, y);
+                setFieldTile(entity->fieldOfView, widthFieldOfView, heightFieldOfView, pointValue);
+                entity->visibleTiles[entity->nbVisibleTiles] = heightFieldOfView * diameter + widthFieldOfView;
+                entity->nbVisibleTiles++;
+
+                if(pointValue != FOG && x >= 0 && x < entity->mentalMap->width && y >= 0 && y < entity->mentalMap->height
+                    && getFieldTile(entity->mentalMap, x, y) == FOG)
                 {
-                    int widthFieldOfView = entity->visionRange + x;
-                    int heightFieldOfView = entity->visionRange + y;
-
-                    if( (widthFieldOfView >= 0) && (widthFieldOfView < 2*entity->visionRange + 1) 
-                        &&  (heightFieldOfView >= 0) && (heightFieldOfView < 2*entity->visionRange + 1) )
-                    {
-                        pointEnum currentValue;
-
-                        entity->fieldOfView[widthFieldOfView][heightFieldOfView].x = (int)(entity->x + x);
-                        entity->fieldOfView[widthFieldOfView][heightFieldOfView].y = (int)(entity->y + y);
-
-                        currentValue = aField->data[(int)(entity->x + x)][(int)(entity->y + y)];
-                        entity->fieldOfView[widthFieldOfView][heightFieldOfView].pointValue = currentValue;
-
-                        if(currentValue == WALL)
-                        {
-                            aWall = true;
-                        }
-                    }
+                    entity->revealedTiles[entity->nbRevealedTiles] = (Point){x, y, pointValue};
+                    entity->nbRevealedTiles++;
                 }
             }
         }
@@ -296,7 +364,7 @@ Field* getFieldOfViewFromMap(Field* map, int x, int y, int visionRange)
                     if (0 < width && width < map->width && 0 < height && height < map->height)
                     {
                         // We add it to the mental map
-                        fieldOfView->data[width - x + visionRange][height - y + visionRange] = map->data[width][height];
+                        setFieldTile(fieldOfView, width - x + visionRange, height - y + visionRange, getFieldTile(map, width, height));
                     }
                 }
             }
@@ -349,7 +417,7 @@ InputNeuralNetwork* createInput(Field* fieldOfView, int x, int y, int xEnd, int
                     if (distanceSquare < radiusSquare)
                     {
                         //We add it to the inputs
-                        input->data[dataIndex] = neuroneTransferFunction(fieldOfView->data[width + visionRange][height + visionRange]);
+                        input->data[dataIndex] = neuroneTransferFunction(getFieldTile(fieldOfView, width + visionRange, height + visionRange));
                         //We go to the next input's data
                         dataIndex++;
                     }
@@ -378,17 +446,23 @@ InputNeuralNetwork* createInput(Field* fieldOfView, int x, int y, int xEnd, int
 float* createInputNN2(Field* field, int entityX, int entityY, int xEnd, int yEnd)
 {
     int widthIndex, heightIndex;
-    int inputIndex = 0;
+    int inputIndex = field->height * field->width;
     float *input = (float*)malloc(( 4 + field->height * field->width) * sizeof(float));
-    for(widthIndex = 0; widthIndex < field->width; widthIndex++)
+    //We read the tiles in the order they are stored, the input keeps its column by column layout
+    for(heightIndex = 0; heightIndex < field->height; heightIndex++)
     {
-        for(heightIndex = 0; heightIndex < field->height; heightIndex++)
+        const fieldTile *row = getFieldRow(field, heightIndex);
+        float *inputColumn = input + heightIndex;
+        for(widthIndex = 0; widthIndex < field->width; widthIndex++)
         {
-            if(field->data[widthIndex][heightIndex] == EMPTY || field->data[widthIndex][heightIndex] == VISITED)
-                input[inputIndex] = 1;
+            if(row[widthIndex] == EMPTY || row[widthIndex] == VISITED)
+            {
+                inputColumn[widthIndex * field->height] = 1;
+            }
             else
-                input[inputIndex] = 0;
-            inputIndex++;
+            {
+                inputColumn[widthIndex * field->height] = 0;
+            }
         }
     }
 
@@ -442,7 +516,7 @@ void updateInterestField(InterestField* interestField, NeuralNetwork* neuralNetw
         {
             for(height = 0; height < interestField->height; height++)
             {
-                if (mentalMap->data[width][height] != EMPTY)
+                if (getFieldTile(mentalMap, width, height) != EMPTY)
                 {
                     interestField->data[width][height] = 0;
                 }
@@ -463,9 +537,123 @@ void updateInterestField(InterestField* interestField, NeuralNetwork* neuralNetw
     }
 }
 
+/**
+ * \fn static void updateInterestCacheEntity(Entity* entity, bool hasEnd, int xEnd, int yEnd, LabelingWeights* labelingWeights)
+ * \brief function that updates the labeling kept by an entity after its mental map changed
+ * Only the tiles whose field of view contains a changed tile are labeled again,
+ * unless the labeling function, the end point or the weights changed
+ *
+ * \param entity : the entity
+ * \param hasEnd : true to use getLabelingBase3 (with the end point), false to use getLabelingBase4
+ * \param xEnd, yEnd : the coordinates of the end point
+ * \param labelingWeights : Ze labeling weights
+ * \return void
+ */
+static void updateInterestCacheEntity(Entity* entity, bool hasEnd, int xEnd, int yEnd, LabelingWeights* labelingWeights)
+{
+    InterestCache* cache = entity->interestCache;
+    Field* mentalMap = entity->mentalMap;
+    int range = entity->visionRange;
+    int xMin, xMax, yMin, yMax;
+
+    if(!cache->isValid || cache->hasEnd != hasEnd
+        || (hasEnd && (cache->xEnd != xEnd || cache->yEnd != yEnd))
+        || memcmp(&(cache->labelingWeights), labelingWeights, sizeof(LabelingWeights)) != 0)
+    {
+        //We label the whole mental map
+        xMin = 0;
+        xMax = mentalMap->width - 1;
+        yMin = 0;
+        yMax = mentalMap->height - 1;
+    }
+    else if(entity->xDirtyMin <= entity->xDirtyMax)
+    {
+        //The tiles which can see a changed tile
+        xMin = entity->xDirtyMin - range;
+        xMax = entity->xDirtyMax + range;
+        yMin = entity->yDirtyMin - range;
+        yMax = entity->yDirtyMax + range;
+    }
+    else
+    {
+        return;
+    }
+
+    //The summed-area tables must cover the fields of view of the labeled tiles
+    const DiskMask* mask = getSharedDiskMask(range);
+    FeatureEngine* engine = getSharedFeatureEngine(mentalMap->width, mentalMap->height);
+    updateFeatureEngineRegion(engine, mentalMap, mask, xMin - range, xMax + range, yMin - range, yMax + range);
+    if(xMin < 0)
+    {
+        xMin = 0;
+    }
+    if(xMax > mentalMap->width - 1)
+    {
+        xMax = mentalMap->width - 1;
+    }
+    if(yMin < 0)
+    {
+        yMin = 0;
+    }
+    if(yMax > mentalMap->height - 1)
+    {
+        yMax = mentalMap->height - 1;
+    }
+
+    LabelingFeatures features;
+    int width, height;
+    for(width = xMin; width <= xMax; width++)
+    {
+        double* column = cache->labeling + width * mentalMap->height;
+        for(height = yMin; height <= yMax; height++)
+        {
+            getLabelingFeatures(engine, width, height, &features);
+            if(hasEnd)
+            {
+                column[height] = getLabelingBase3(&features, width, height, xEnd, yEnd, labelingWeights);
+            }
+            else
+            {
+                column[height] = getLabelingBase4(&features, labelingWeights);
+            }
+        }
+    }
+
+    cache->isValid = true;
+    cache->hasEnd = hasEnd;
+    cache->xEnd = xEnd;
+    cache->yEnd = yEnd;
+    cache->labelingWeights = *labelingWeights;
+    clearDirtyRegionEntity(entity);
+}
+
+/**
+ * \fn static void addDistanceFromEntity(InterestField* interestField, Entity* entity, LabelingWeights* labelingWeights)
+ * \brief function that fills an interest field with the labeling kept by an entity and the distance from the entity
+ *
+ * \param interestField : the interest field that will be update
+ * \param entity : the entity, with an up to date labeling
+ * \param labelingWeights : Ze labeling weights
+ * \return void
+ */
+static void addDistanceFromEntity(InterestField* interestField, Entity* entity, LabelingWeights* labelingWeights)
+{
+    int width, height;
+    for(width = 0; width < interestField->width; width++)
+    {
+        const double* column = entity->interestCache->labeling + width * interestField->height;
+        for(height = 0; height < interestField->height; height++)
+        {
+            double distFromEntity = sqrt(pow(entity->x-width,2) + pow(entity->y-height,2));
+            interestField->data[width][height] = (float) (column[height] + distFromEntity*labelingWeights->weights[DIST_FROM_ENTITY]);
+        }
+    }
+}
+
 /**
  * \fn void updateInterestField2(InterestField* interestField, int xEnd, int yEnd, Entity* entity, LabelingWeights* labelingWeights)
  * \brief function that change the values in an interest field according to the labelisation function
+ * The labeling is kept by the entity : only the tiles near the tiles of the mental map changed since the last call are labeled again
  *
  * \param InterestField* interestField : the interest field that will be update
  * \param int xEnd : x coordinate of the ending point
@@ -479,24 +667,16 @@ void updateInterestField2(InterestField* interestField, int xEnd, int yEnd, Enti
 {
     if (interestField != NULL && entity != NULL && labelingWeights != NULL)
     {
-        int width, height;
-        for(width = 0; width < interestField->width; width++)
-        {
-            for(height = 0; height < interestField->height; height++)
-            {
-                Field* fieldOfView = getFieldOfViewFromMap(entity->mentalMap, width, height, entity->visionRange);
-                
-                interestField->data[width][height] = labeling3(fieldOfView, width, height, xEnd, yEnd, entity, labelingWeights);
-                
-                destructField(&fieldOfView);
-            }
-        }
+        //Only the tiles near the changes of the mental map are labeled again
+        updateInterestCacheEntity(entity, true, xEnd, yEnd, labelingWeights);
+        addDistanceFromEntity(interestField, entity, labelingWeights);
     }
 }
 
 /**
  * \fn void updateInterestField3(InterestField* interestField, Entity* entity, LabelingWeights* labelingWeights)
  * \brief function that change the values in an interest field according to the labelisation function
+ * The labeling is kept by the entity : only the tiles near the tiles of the mental map changed since the last call are labeled again
  *
  * \param InterestField* interestField : the interest field that will be update
  * \param Entity* entity : the entity on which we base the update of the interest field
@@ -508,18 +688,9 @@ void updateInterestField3(InterestField* interestField, Entity* entity, Labeling
 {
     if (interestField != NULL && entity != NULL && labelingWeights != NULL)
     {
-        int width, height;
-        for(width = 0; width < interestField->width; width++)
-        {
-            for(height = 0; height < interestField->height; height++)
-            {
-                Field* fieldOfView = getFieldOfViewFromMap(entity->mentalMap, width, height, entity->visionRange);
-                
-                interestField->data[width][height] = labeling4(fieldOfView, width, height, entity, labelingWeights);
-                
-                destructField(&fieldOfView);
-            }
-        }
+        //Only the tiles near the changes of the mental map are labeled again
+        updateInterestCacheEntity(entity, false, 0, 0, labelingWeights);
+        addDistanceFromEntity(interestField, entity, labelingWeights);
     }
 }
 
@@ -558,6 +729,290 @@ void updateBestWantedPosition(node* wantedPosition, InterestField* interestField
     }
 }
 
+/**
+ * \fn static bool isBeforeInRanking(const InterestRanking* ranking, int first, int second)
+ * \brief function that tells if an element of a ranking must come before another one
+ * The highest interest comes first, and on a tie the first tile in the order updateBestWantedPosition goes through them
+ *
+ * \param ranking : the ranking
+ * \param first, second : the positions of the two elements in the heap
+ * \return bool
+ */
+static bool isBeforeInRanking(const InterestRanking* ranking, int first, int second)
+{
+    if(ranking->scores[first] != ranking->scores[second])
+    {
+        return ranking->scores[first] > ranking->scores[second];
+    }
+    return ranking->tiles[first] < ranking->tiles[second];
+}
+
+/**
+ * \fn static void siftDownRanking(InterestRanking* ranking, int position)
+ * \brief function that moves an element of a ranking down the heap until it is at its place
+ *
+ * \param ranking : the ranking
+ * \param position : the position of the element in the heap
+ * \return void
+ */
+static void siftDownRanking(InterestRanking* ranking, int position)
+{
+    while(2*position + 1 < ranking->size)
+    {
+        int best = 2*position + 1;
+        if(best + 1 < ranking->size && isBeforeInRanking(ranking, best + 1, best))
+        {
+            best++;
+        }
+        if(!isBeforeInRanking(ranking, best, position))
+        {
+            return;
+        }
+
+        int tile = ranking->tiles[position];
+        float score = ranking->scores[position];
+        ranking->tiles[position] = ranking->tiles[best];
+        ranking->scores[position] = ranking->scores[best];
+        ranking->tiles[best] = tile;
+        ranking->scores[best] = score;
+        position = best;
+    }
+}
+
+/**
+ * \fn InterestRanking* initInterestRanking(int capacity)
+ * \brief function that creates an empty ranking of the tiles of an interest field
+ *
+ * \param capacity : the number of tiles of the interest fields that will be ranked
+ * \return InterestRanking*
+ */
+InterestRanking* initInterestRanking(int capacity)
+{
+    InterestRanking* ranking = (InterestRanking*)malloc(sizeof(InterestRanking));
+    ranking->size = 0;
+    ranking->capacity = capacity;
+    ranking->height = 0;
+    ranking->tiles = (int*)malloc(sizeof(int) * capacity);
+    ranking->scores = (float*)malloc(sizeof(float) * capacity);
+    return ranking;
+}
+
+/**
+ * \fn void destructInterestRanking(InterestRanking** ranking)
+ * \brief function that free a ranking out of memory
+ *
+ * \param ranking : a double pointer on the ranking
+ * \return void
+ */
+void destructInterestRanking(InterestRanking** ranking)
+{
+    if(ranking != NULL && *ranking != NULL)
+    {
+        free((*ranking)->tiles);
+        free((*ranking)->scores);
+        free(*ranking);
+        *ranking = NULL;
+    }
+}
+
+/**
+ * \fn void rankInterestField(InterestRanking* ranking, InterestField* interestField)
+ * \brief function that ranks all the tiles of an interest field, in a time linear with the number of tiles
+ * Must be called once per decision, after the interest field has been updated
+ *
+ * \param ranking : the ranking, with a capacity large enought for the interest field
+ * \param interestField : the interest field to rank
+ * \return void
+ */
+void rankInterestField(InterestRanking* ranking, InterestField* interestField)
+{
+    ranking->size = 0;
+    ranking->height = interestField->height;
+
+    int width, height;
+    for(width = 0; width < interestField->width; width++)
+    {
+        for(height = 0; height < interestField->height; height++)
+        {
+            //The tiles without any interest can never be chosen
+            if(interestField->data[width][height] > -INFINITY)
+            {
+                ranking->tiles[ranking->size] = width * interestField->height + height;
+                ranking->scores[ranking->size] = interestField->data[width][height];
+                ranking->size++;
+            }
+        }
+    }
+
+    //We build the heap from the bottom
+    int position;
+    for(position = ranking->size/2 - 1; position >= 0; position--)
+    {
+        siftDownRanking(ranking, position);
+    }
+}
+
+/**
+ * \fn void updateBestWantedPositionFromRanking(node* wantedPosition, InterestRanking* ranking)
+ * \brief function that change the coordinate of a node to the best coordinate which is still in a ranking,
+ * and removes it from the ranking. It gives the same positions, in the same order, as repeated calls of updateBestWantedPosition
+ * When there is no tile left, the node is set to (0, 0)
+ *
+ * \param node* wantedPosition : the node which will be updated to the next best position
+ * \param InterestRanking* ranking : the ranking of the interest field
+ * \return void
+ */
+void updateBestWantedPositionFromRanking(node* wantedPosition, InterestRanking* ranking)
+{
+    if (wantedPosition != NULL && ranking != NULL)
+    {
+        wantedPosition->x = 0;
+        wantedPosition->y = 0;
+        if(ranking->size > 0)
+        {
+            wantedPosition->x = ranking->tiles[0] / ranking->height;
+            wantedPosition->y = ranking->tiles[0] % ranking->height;
+
+            //We remove the best tile from the heap
+            ranking->size--;
+            ranking->tiles[0] = ranking->tiles[ranking->size];
+            ranking->scores[0] = ranking->scores[ranking->size];
+            siftDownRanking(ranking, 0);
+        }
+    }
+}
+
+/**
+ * \fn node *findPathToCandidates(Entity *entity, node *startNode, node *wantedPosition, bool *endEvent)
+ * \brief function that finds a path to the first position the entity can reach, trying the wanted position
+ * and then the positions left in the ranking of the entity, from the best to the worst.
+ * With ASTAR_SEARCH, an A* search is made for each position which can be reached, the other ones are skipped
+ * after a flood of the mental map with a grid of bits. With FLOOD_SEARCH, the mental map is flooded once
+ * and the path is read from the flood, so the unreachable positions are skipped without any search.
+ * With INCREMENTAL_SEARCH, the wanted position is searched with the planner of the entity, which only repairs
+ * its distances where the mental map changed as long as the wanted position stays the same.
+ * With HIERARCHICAL_SEARCH, the positions are searched between the clusters of the mental map, and the path
+ * only goes to the first entrance on the way.
+ * The paths of the flood are shortest paths, so they can differ from the paths of the A* search.
+ *
+ * \param entity : the entity, whose ranking has been updated with rankInterestField
+ * \param startNode : the position of the entity
+ * \param wantedPosition : the first position to try, it is changed to the position the path goes to
+ * \param endEvent : pointer to boolean that will trigger the end of the function
+ * \return node* : the path, startNode if no position can be reached, NULL if the search has been interrupted
+ */
+node *findPathToCandidates(Entity *entity, node *startNode, node *wantedPosition, bool *endEvent)
+{
+    //Use to store the path found by the pathfinding
+    node* path = NULL;
+    if(getSearchMode() == FLOOD_SEARCH)
+    {
+        if(*endEvent)
+        {
+            return NULL;
+        }
+        //We flood the mental map once to know all the positions we can reach
+        SearchGrid* grid = getSharedSearchGrid(entity->mentalMap->width, entity->mentalMap->height);
+        floodSearchGrid(grid, startNode, entity->mentalMap);
+        while(!isReachedSearchGrid(grid, wantedPosition->x, wantedPosition->y))
+        {
+            //When there is no position left, there is no path
+            if(entity->interestRanking->size == 0)
+            {
+                return startNode;
+            }
+            //We change our wanted node to the next best position of the ranking
+            updateBestWantedPositionFromRanking(wantedPosition, entity->interestRanking);
+        }
+        return getPathFromGrid(grid, wantedPosition);
+    }
+    if(getSearchMode() == INCREMENTAL_SEARCH && !*endEvent)
+    {
+        if(entity->planner == NULL)
+        {
+            entity->planner = initIncrementalPlanner(entity->mentalMap->width, entity->mentalMap->height);
+        }
+        //The distances to the wanted position are kept by the planner, so only the changes of the mental map are searched
+        setGoalIncrementalPlanner(entity->planner, entity->mentalMap, wantedPosition->x, wantedPosition->y);
+        path = findPathFromIncrementalPlanner(entity->planner, startNode);
+        if(path != startNode)
+        {
+            return path;
+        }
+        //We change our wanted node to the best position found by the ranking
+        updateBestWantedPositionFromRanking(wantedPosition, entity->interestRanking);
+    }
+    if(getSearchMode() == HIERARCHICAL_SEARCH)
+    {
+        if(entity->clusterGraph == NULL)
+        {
+            entity->clusterGraph = initClusterGraph(entity->mentalMap->width, entity->mentalMap->height, CLUSTER_SIZE);
+        }
+        setMapClusterGraph(entity->clusterGraph, entity->mentalMap);
+        path = findFirstPathClusterGraph(entity->clusterGraph, startNode, wantedPosition);
+        while(path == startNode && !*endEvent)
+        {
+            //When there is no position left, there is no path
+            if(entity->interestRanking->size == 0)
+            {
+                return startNode;
+            }
+            //We change our wanted node to the next best position of the ranking
+            updateBestWantedPositionFromRanking(wantedPosition, entity->interestRanking);
+            path = findFirstPathClusterGraph(entity->clusterGraph, startNode, wantedPosition);
+        }
+        if(path == startNode)
+        {
+            //The search has been interrupted
+            return NULL;
+        }
+        return path;
+    }
+    
+    if(getHeuristicMode() == LANDMARK_HEURISTIC)
+    {
+        if(entity->landmarks == NULL)
+        {
+            entity->landmarks = initLandmarks(entity->mentalMap->width, entity->mentalMap->height);
+        }
+        //The landmarks are only computed again when the walls of the mental map changed
+        setMapLandmarks(entity->landmarks, entity->mentalMap);
+        useLandmarks(entity->landmarks);
+    }
+    //We flood the mental map once with a grid of bits to know the positions we can reach,
+    //an A* search to a position we can't reach would go through all the tiles we can reach before failing
+    BitGrid* reachable = getSharedBitGrid(entity->mentalMap->width, entity->mentalMap->height);
+    setFieldBitGrid(reachable, entity->mentalMap);
+    floodBitGrid(reachable, startNode->x, startNode->y);
+    //We try to find a path
+    while((path == startNode || path == NULL) && !*endEvent)
+    {
+        destructNodes(&path);
+        if(isReachedBitGrid(reachable, wantedPosition->x, wantedPosition->y))
+        {
+            //We try to find a path
+            path = findPathFromStartEnd(startNode, wantedPosition, entity->mentalMap, endEvent);
+        }
+        else
+        {
+            path = startNode;
+            //When no position left can be reached, there is no path
+            if(entity->interestRanking->size == 0)
+            {
+                break;
+            }
+        }
+        //If we haven't find a path
+        if ((path == startNode || path == NULL))
+        {
+            //We change our wanted node to the best position found by the ranking
+            updateBestWantedPositionFromRanking(wantedPosition, entity->interestRanking);
+        }
+    }
+    useLandmarks(NULL);
+    return path;
+}
+
 /**
  * \fn node *findNextPathNN(Entity *entity, node *startNode, node *endNode, dataType *data, NeuralNetwork *neuralNetwork)
  * \brief returns the next path chosen by a given neural network
@@ -577,25 +1032,14 @@ node *findNextPathNN(Entity *entity, node *endNode, dataType *data, NeuralNetwor
 
     //We update each values of the interest field with what our neural network think
     updateInterestField(interestField, neuralNetwork, entity->mentalMap, endNode->x, endNode->y, entity->visionRange);
+    //We rank the positions once, from the most interesting to the least
+    rankInterestField(entity->interestRanking, interestField);
     
     //We set a default wanted node
     node *wantedPosition = cpyNode(endNode);
     
-    //Use to store the path found by the pathfinding
-    node* path = NULL;
-    //We try to find a path
-    while((path == startNode || path == NULL) && !data->endEvent)
-    {
-        destructNodes(&path);
-        //We try to find a path
-        path = findPathFromStartEnd(startNode, wantedPosition, entity->mentalMap, &(data->endEvent));
-        //If we haven't find a path
-        if ((path == startNode || path == NULL))
-        {
-            //We change our wanted node to the best position found by the neural network
-            updateBestWantedPosition(wantedPosition, interestField);
-        }
-    }
+    //We find a path to the best position we can reach
+    node* path = findPathToCandidates(entity, startNode, wantedPosition, &(data->endEvent));
     destructInterestField(&interestField);
     destructNodes(&wantedPosition);
 
@@ -639,17 +1083,31 @@ node *findNextPathNN2(Entity *entity, dataType *data, float *output)
 
     //Use to store the path found by the pathfinding
     node* path = NULL;
+    //We flood the mental map once with a grid of bits to know the positions we can reach,
+    //the mental map and the start don't change while we look for a wanted position
+    BitGrid* reachable = getSharedBitGrid(entity->mentalMap->width, entity->mentalMap->height);
+    setFieldBitGrid(reachable, entity->mentalMap);
+    floodBitGrid(reachable, startNode->x, startNode->y);
     //We try to find a path
     while((path == startNode || path == NULL) && !data->endEvent)
     {   
         destructNodes(&path);
-        //We try to find a path
-        path = findPathFromStartEnd(startNode, wantedPosition, entity->mentalMap, &(data->endEvent));
+        //We only search a path if the wanted position can be reached at all
+        path = startNode;
+        if(isReachedBitGrid(reachable, wantedPosition->x, wantedPosition->y))
+        {
+            //We try to find a path
+            path = findPathFromStartEnd(startNode, wantedPosition, entity->mentalMap, &(data->endEvent));
+        }
         //If we haven't find a path
         if ((path == startNode || path == NULL))
         {            
-            //We change our wanted node to the nearest position available
-            node *tmp = nearestNode(entity->mentalMap, wantedPosition->x, wantedPosition->y);
+            //We change our wanted node to the nearest position available, read from the index kept by the entity
+            if(entity->nearestIndex == NULL)
+            {
+                entity->nearestIndex = initNearestIndex(entity->mentalMap->width, entity->mentalMap->height);
+            }
+            node *tmp = findNearestNodeIndex(entity->nearestIndex, entity->mentalMap, wantedPosition->x, wantedPosition->y);
             if(tmp->x == wantedPosition->x && tmp->y == wantedPosition->y)
             {
                 destructNodes(&tmp);
@@ -679,32 +1137,19 @@ node *findNextPathNN2(Entity *entity, dataType *data, float *output)
 node *findNextPathGN(Entity *entity, node *endNode, dataType *data, LabelingWeights* labelingWeights)
 {
     node *startNode = initNode(entity->x, entity->y, 0, 0);
-    //We initialize an interest field
-    InterestField* interestField = initialiseInterestField(entity->mentalMap->width, entity->mentalMap->height);
+    //We use the interest field of the entity
+    InterestField* interestField = entity->interestField;
 
     //We update each values of the interest field with what our neural network think
     updateInterestField2(interestField, endNode->x, endNode->y, entity, labelingWeights);
+    //We rank the positions once, from the most interesting to the least
+    rankInterestField(entity->interestRanking, interestField);
     
     //We set a default wanted node
     node *wantedPosition = cpyNode(endNode);
     
-    //Use to store the path found by the pathfinding
-    node* path = NULL;
-    //We try to find a path
-    while((path == startNode || path == NULL) && !data->endEvent)
-    {
-        destructNodes(&path);
-        //We try to find a path
-        path = findPathFromStartEnd(startNode, wantedPosition, entity->mentalMap, &(data->endEvent));
-        //printf("%p %p\n", (void*) path, (void*) startNode);
-        //If we haven't find a path
-        if ((path == startNode || path == NULL))
-        {
-            //We change our wanted node to the best position found by the neural network
-            updateBestWantedPosition(wantedPosition, interestField);
-        }
-    }
-    destructInterestField(&interestField);
+    //We find a path to the best position we can reach
+    node* path = findPathToCandidates(entity, startNode, wantedPosition, &(data->endEvent));
     destructNodes(&wantedPosition);
 
     return path;
@@ -723,54 +1168,44 @@ node *findNextPathGN(Entity *entity, node *endNode, dataType *data, LabelingWeig
 node *findNextPathGN2(Entity *entity, dataType *data, LabelingWeights* labelingWeights)
 {
     node *startNode = initNode(entity->x, entity->y, 0, 0);
-    //We initialize an interest field
-    InterestField* interestField = initialiseInterestField(entity->mentalMap->width, entity->mentalMap->height);
+    //We use the interest field of the entity
+    InterestField* interestField = entity->interestField;
 
     //We update each values of the interest field with what our neural network think
     updateInterestField3(interestField, entity, labelingWeights);
+    //We rank the positions once, from the most interesting to the least
+    rankInterestField(entity->interestRanking, interestField);
     
-    //We set a default wanted node
+    //We start with the best position found by the genetic network
     node *wantedPosition = initNode(0, 0, 0, 0);
+    updateBestWantedPositionFromRanking(wantedPosition, entity->interestRanking);
     
-    //Use to store the path found by the pathfinding
-    node* path = NULL;
-    //We try to find a path
-    while((path == startNode || path == NULL) && !data->endEvent)
-    {
-        if ((path == startNode || path == NULL))
-        {
-            //We change our wanted node to the best position found by the neural network
-            updateBestWantedPosition(wantedPosition, interestField);
-        }
-        
-        destructNodes(&path);
-        //We try to find a path
-        path = findPathFromStartEnd(startNode, wantedPosition, entity->mentalMap, &(data->endEvent));
-        //If we haven't find a path
-       
-    }
-    destructInterestField(&interestField);
+    //We find a path to the best position we can reach
+    node* path = findPathToCandidates(entity, startNode, wantedPosition, &(data->endEvent));
     destructNodes(&wantedPosition);
 
     return path;
 }
 
 /**
- * \fn node* labeling2(Entity *entity, int xEnd, int yEnd, Field *field, dataType *data)
+ * \fn node* labeling2(Entity *entity, int xEnd, int yEnd, Field *field, uint64_t fieldKey)
  * \brief function that returns the expected choice for the neural network
+ * The shortest path to the destination is read from the distances to the destination kept by the shared distance cache,
+ * so they are only computed once for each field and destination
  *
  * \param entity : entity that is moving
  * \param xEnd, yEnd : coordinates of the destination
  * \param field : the complete field for the supervised learning
- * \param data : the structure we use to raise a flag for interruption
+ * \param fieldKey : the key of the field (see getFieldKey)
  * 
  * \return node*
  */
-node *labeling2(Entity *entity, int xEnd, int yEnd, Field *field, dataType *data)
+node *labeling2(Entity *entity, int xEnd, int yEnd, Field *field, uint64_t fieldKey)
 {
     node *startNode = initNode(entity->x, entity->y, 0, 0);
     node *endNode = initNode(xEnd, yEnd, 0, 0);
-    node *completePath = findPathFromStartEnd(startNode, endNode, field, &data->endEvent);
+    const DistanceField *distanceToEnd = getDistanceField(getSharedDistanceCache(), field, fieldKey, xEnd, yEnd);
+    node *completePath = findPathFromDistanceField(distanceToEnd, startNode);
     node *destination = popNode(&completePath);
 
     bool endLoop = false;
@@ -778,7 +1213,7 @@ node *labeling2(Entity *entity, int xEnd, int yEnd, Field *field, dataType *data
     {
         int xPath = completePath->x;
         int yPath = completePath->y;
-        pointEnum tileValue = entity->mentalMap->data[xPath][yPath];
+        pointEnum tileValue = getFieldTile(entity->mentalMap, xPath, yPath);
 
         if (tileValue != EMPTY && tileValue != VISITED)
             endLoop = true;
@@ -793,178 +1228,62 @@ node *labeling2(Entity *entity, int xEnd, int yEnd, Field *field, dataType *data
 }
 
 /**
- * \fn float labeling3(Field* fieldOfView, int xPosition, int yPosition, int xFinalPosition, int yFinalPosition, Entity* entity, LabelingWeights* labelingWeights)
- * \brief function that returns the labeling of the points
- * will be used for labelisation
+ * \fn double getLabelingBase3(LabelingFeatures* features, int xPosition, int yPosition, int xFinalPosition, int yFinalPosition, LabelingWeights* labelingWeights)
+ * \brief function that returns the labeling of a position with an end point, without the distance from the entity,
+ * which updateInterestField2 adds to it
  *
- * \param Field* fieldOfView : a field of view
+ * \param LabelingFeatures* features : the features of the field of view centered on the position
  * \param int xPosition : x coordinate of the center of the field of view
  * \param int yPosition : y coordinate of the center of the field of view
  * \param int xFinalPosition : x coordinate of the end point
  * \param int yFinalPosition : y coordinate of the end point
- * \param Entity* entity : the entity which uses the function to navigate (only use his coordiantes)
  * \param LabelingWeights* labelingWeights : Ze labeling weights
- * \return float
+ * \return double
  */
-float labeling3(Field* fieldOfView, int xPosition, int yPosition, int xFinalPosition, int yFinalPosition, Entity* entity, LabelingWeights* labelingWeights)
+double getLabelingBase3(LabelingFeatures* features, int xPosition, int yPosition, int xFinalPosition, int yFinalPosition, LabelingWeights* labelingWeights)
 {
-    double emptyPoint = 0;
-    double wallPoint = 0;
-    double fogPoint = 0;
-    double visitedPoint = 0;
-    double dist = 0;
-    double avgDistEmpty = 0;
-    double avgDistWall = 0;
-    double avgDistFog = 0;
-    double avgDistVisited = 0;
-    double distFromEntity = 0;
-    double value = 0;
-    double centerPointx = (fieldOfView->width-1)/2;
-    double centerPointy = (fieldOfView->height-1)/2;
-
-
-    if (fieldOfView->data[(int)centerPointx][(int)centerPointy] != EMPTY) 
+    if (!features->isCenterEmpty) 
     {
         return -INFINITY;
     }
-    
-    for(int width = 0; width < fieldOfView->width; width++)
-    {
-        for(int height = 0; height < fieldOfView->height; height++)
-        {
-            switch (fieldOfView->data[width][height])
-            {
-                case EMPTY:
-                    avgDistEmpty += sqrt(pow(width-centerPointx,2) + pow(height-centerPointy,2));
-                    emptyPoint++;
-                    break;
-                case WALL:
-                    avgDistWall += sqrt(pow(width-centerPointx,2) + pow(height-centerPointy,2));
-                    wallPoint++;
-                    break;
-                case FOG:
-                    if(isVisibleFrom(fieldOfView, (fieldOfView->width-1)/2, (fieldOfView->height-1)/2, width, height))
-                    {
-                        avgDistFog += sqrt(pow(width-centerPointx,2) + pow(height-centerPointy,2));
-                        fogPoint++;
-                    }
-                    break;
-                case VISITED:
-                    avgDistVisited += sqrt(pow(width-centerPointx,2) + pow(height-centerPointy,2));
-                    visitedPoint++;
-                    break;
-            }
-        }
-    }
 
-    dist = sqrt(pow(xFinalPosition-xPosition,2) + pow(yFinalPosition-yPosition,2));
-    distFromEntity = sqrt(pow(entity->x-xPosition,2) + pow(entity->y-yPosition,2));
-    if (emptyPoint != 0)
-        avgDistEmpty /= emptyPoint;
-    if (wallPoint != 0)
-        avgDistWall /= wallPoint;
-    if (fogPoint != 0)
-        avgDistFog /= fogPoint;
-    if (visitedPoint != 0)
-        avgDistVisited /= visitedPoint;
-
-    value = dist*labelingWeights->weights[DIST]+
-            emptyPoint*labelingWeights->weights[NB_EMPTY]+
-            wallPoint*labelingWeights->weights[NB_WALL]+
-            fogPoint*labelingWeights->weights[NB_FOG]+
-            visitedPoint*labelingWeights->weights[NB_VISITED]+
-            avgDistEmpty*labelingWeights->weights[AVG_DIST_EMPTY]+
-            avgDistWall*labelingWeights->weights[AVG_DIST_WALL]+
-            avgDistFog*labelingWeights->weights[AVG_DIST_FOG]+
-            avgDistVisited*labelingWeights->weights[AVG_DIST_VISITED]+
-            distFromEntity*labelingWeights->weights[DIST_FROM_ENTITY];
-    
-    return (float) value;
+    double dist = sqrt(pow(xFinalPosition-xPosition,2) + pow(yFinalPosition-yPosition,2));
+
+    return dist*labelingWeights->weights[DIST]+
+            features->emptyPoint*labelingWeights->weights[NB_EMPTY]+
+            features->wallPoint*labelingWeights->weights[NB_WALL]+
+            features->fogPoint*labelingWeights->weights[NB_FOG]+
+            features->visitedPoint*labelingWeights->weights[NB_VISITED]+
+            features->avgDistEmpty*labelingWeights->weights[AVG_DIST_EMPTY]+
+            features->avgDistWall*labelingWeights->weights[AVG_DIST_WALL]+
+            features->avgDistFog*labelingWeights->weights[AVG_DIST_FOG]+
+            features->avgDistVisited*labelingWeights->weights[AVG_DIST_VISITED];
 }
 
 /**
- * \fn float labeling4(Field* fieldOfView, int xPosition, int yPosition, Entity* entity, LabelingWeights* labelingWeights)
- * \brief function that returns the labeling of the points
- * will be used for labelisation
+ * \fn double getLabelingBase4(LabelingFeatures* features, LabelingWeights* labelingWeights)
+ * \brief function that returns the labeling of a position without an end point, without the distance from the entity,
+ * which updateInterestField3 adds to it
  *
- * \param Field* fieldOfView : a field of view
- * \param int xPosition : x coordinate of the center of the field of view
- * \param int yPosition : y coordinate of the center of the field of view
- * \param Entity* entity : the entity which uses the function to navigate (only use his coordiantes)
+ * \param LabelingFeatures* features : the features of the field of view centered on the position
  * \param LabelingWeights* labelingWeights : Ze labeling weights
- * \return float
+ * \return double
  */
-float labeling4(Field* fieldOfView, int xPosition, int yPosition, Entity* entity, LabelingWeights* labelingWeights)
+double getLabelingBase4(LabelingFeatures* features, LabelingWeights* labelingWeights)
 {
-    double emptyPoint = 0;
-    double wallPoint = 0;
-    double fogPoint = 0;
-    double visitedPoint = 0;
-    double avgDistEmpty = 0;
-    double avgDistWall = 0;
-    double avgDistFog = 0;
-    double avgDistVisited = 0;
-    double distFromEntity = 0;
-    double value = 0;
-    double centerPointx = (fieldOfView->width-1)/2;
-    double centerPointy = (fieldOfView->height-1)/2;
-
-
-    if (fieldOfView->data[(int)centerPointx][(int)centerPointy] != EMPTY) 
+    if (!features->isCenterEmpty) 
     {
         return -INFINITY;
     }
-    
-    for(int width = 0; width < fieldOfView->width; width++)
-    {
-        for(int height = 0; height < fieldOfView->height; height++)
-        {
-            switch (fieldOfView->data[width][height])
-            {
-                case EMPTY:
-                    avgDistEmpty += sqrt(pow(width-centerPointx,2) + pow(height-centerPointy,2));
-                    emptyPoint++;
-                    break;
-                case WALL:
-                    avgDistWall += sqrt(pow(width-centerPointx,2) + pow(height-centerPointy,2));
-                    wallPoint++;
-                    break;
-                case FOG:
-                    if(isVisibleFrom(fieldOfView, (fieldOfView->width-1)/2, (fieldOfView->height-1)/2, width, height))
-                    {
-                        avgDistFog += sqrt(pow(width-centerPointx,2) + pow(height-centerPointy,2));
-                        fogPoint++;
-                    }
-                    break;
-                case VISITED:
-                    avgDistVisited += sqrt(pow(width-centerPointx,2) + pow(height-centerPointy,2));
-                    visitedPoint++;
-                    break;
-            }
-        }
-    }
 
-    distFromEntity = sqrt(pow(entity->x-xPosition,2) + pow(entity->y-yPosition,2));
-    if (emptyPoint != 0)
-        avgDistEmpty /= emptyPoint;
-    if (wallPoint != 0)
-        avgDistWall /= wallPoint;
-    if (fogPoint != 0)
-        avgDistFog /= fogPoint;
-    if (visitedPoint != 0)
-        avgDistVisited /= visitedPoint;
-
-    value = emptyPoint*labelingWeights->weights[NB_EMPTY]+
-            wallPoint*labelingWeights->weights[NB_WALL]+
-            fogPoint*labelingWeights->weights[NB_FOG]+
-            visitedPoint*labelingWeights->weights[NB_VISITED]+
-            avgDistEmpty*labelingWeights->weights[AVG_DIST_EMPTY]+
-            avgDistWall*labelingWeights->weights[AVG_DIST_WALL]+
-            avgDistFog*labelingWeights->weights[AVG_DIST_FOG]+
-            avgDistVisited*labelingWeights->weights[AVG_DIST_VISITED]+
-            distFromEntity*labelingWeights->weights[DIST_FROM_ENTITY];
-
-    return (float) value;
+    return features->emptyPoint*labelingWeights->weights[NB_EMPTY]+
+            features->wallPoint*labelingWeights->weights[NB_WALL]+
+            features->fogPoint*labelingWeights->weights[NB_FOG]+
+            features->visitedPoint*labelingWeights->weights[NB_VISITED]+
+            features->avgDistEmpty*labelingWeights->weights[AVG_DIST_EMPTY]+
+            features->avgDistWall*labelingWeights->weights[AVG_DIST_WALL]+
+            features->avgDistFog*labelingWeights->weights[AVG_DIST_FOG]+
+            features->avgDistVisited*labelingWeights->weights[AVG_DIST_VISITED];
 }
 
 /**
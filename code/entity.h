@@ -13,9 +13,14 @@
     #define H_ENTITY
 
 //Define the maximum number of points a field of view can have
-#define RADIUS_VIEWPOINT (5)
+//It can be changed at compile time (-DRADIUS_VIEWPOINT=8), the cost of the field of view only grows with its number of tiles
+#ifndef RADIUS_VIEWPOINT
+    #define RADIUS_VIEWPOINT (5)
+#endif
 
 #include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
 #include <SDL2/SDL.h>
 #include <math.h>
 #include "stats.h"
@@ -23,6 +28,9 @@
 #include "pathfinding.h"
 #include "neuralNetwork.h"
 #include "geneticAlgorithm.h"
+#include "featureEngine.h"
+#include "clusterGraph.h"
+#include "distanceCache.h"
 
 //The structure point used as a point of a field which can be a wall, empty or fog
 typedef struct Point
@@ -32,17 +40,83 @@ typedef struct Point
     pointEnum pointValue;
 } Point;
 
+//The structure used to keep the labeling of the tiles of a mental map between two decisions
+//The labeling is kept without the distance from the entity, which changes at each decision.
+//It is stored column by column like an InterestField
+typedef struct InterestCache
+{
+    double* labeling;
+    bool isValid;
+    bool hasEnd;
+    int xEnd;
+    int yEnd;
+    LabelingWeights labelingWeights;
+} InterestCache;
+
+//The structure used to rank the tiles of an interest field from the most interesting to the least
+//It is a binary heap of the tiles (stored as x*height + y) whose interest is above -INFINITY
+typedef struct InterestRanking
+{
+    int size;
+    int capacity;
+    int height;
+    int* tiles;
+    float* scores;
+} InterestRanking;
+
 //The structure entity used as a token which will be control by our neural network
 typedef struct Entity
 {
     int x;
     int y;
     int visionRange;
-    Point** fieldOfView;
+    //The tiles of the square of side 2*visionRange + 1 around the entity at the last update of its field of view, row by row.
+    //The tile (x, y) of the field of view is the tile (xFieldOfView + x, yFieldOfView + y) of the field
+    Field* fieldOfView;
+    int xFieldOfView, yFieldOfView;
+    //Whether each tile of the field of view is visible, filled by castFieldOfView at each update
+    bool* visibility;
+    //The tiles of the field of view seen at its last update, as indexes y*(2*visionRange + 1) + x of the field of view
+    int* visibleTiles;
+    int nbVisibleTiles;
+    //The tiles seen at the last update of the field of view which were FOG in the mental map
+    Point* revealedTiles;
+    int nbRevealedTiles;
+    //The tiles of the mental map changed by its last update, which are then told to the modules which follow the mental map
+    Point* changedTiles;
+    int nbChangedTiles;
 
     Field* mentalMap;
+    //Bounding box of the tiles of the mental map changed since the interest field was last updated
+    int xDirtyMin, xDirtyMax;
+    int yDirtyMin, yDirtyMax;
+    //The interest field of the entity, kept from a decision to the next one
+    InterestField* interestField;
+    InterestCache* interestCache;
+    InterestRanking* interestRanking;
+    //The distances to the first position the entity tries to go to, kept from a decision to the next one (see INCREMENTAL_SEARCH).
+    //NULL until the search mode uses them
+    IncrementalPlanner* planner;
+    //The clusters of the mental map, kept from a decision to the next one (see HIERARCHICAL_SEARCH).
+    //NULL until the search mode uses them
+    ClusterGraph* clusterGraph;
+    //The landmarks of the mental map, computed again when its walls change (see LANDMARK_HEURISTIC).
+    //NULL until the heuristic uses them
+    Landmarks* landmarks;
+    //The nearest walkable tile of each tile of the mental map, updated where new walkable tiles are seen.
+    //NULL until findNextPathNN2 uses it
+    NearestIndex* nearestIndex;
 } Entity;
 
+//Returns the value of a tile of the field of view of an entity, the tiles being taken in the order they are stored
+//(index from 0 to (2*visionRange + 1)^2 - 1, row after row), and gives its coordinates in the field
+static inline int getFieldOfViewTileEntity(const Entity *entity, int index, int *x, int *y)
+{
+    *x = entity->xFieldOfView + index % entity->fieldOfView->width;
+    *y = entity->yFieldOfView + index / entity->fieldOfView->width;
+    return entity->fieldOfView->data[index];
+}
+
 //The structure used to store the inputs of the neural network
 typedef struct InputNeuralNetwork
 {
@@ -113,7 +187,8 @@ void showEntity(Entity* entity, SDL_Renderer* renderer, SDL_Color color, int til
 
 /**
  * \fn void updateMentalMapEntity(Entity *entity)
- * \brief function that update the mental map of an entity
+ * \brief function that update the mental map of an entity with the tiles revealed by the last update of its field of view,
+ * lists the tiles it changed in changedTiles, and then tells them to the modules which follow the mental map (see addDirtyTileEntity)
  *
  * \param entity : the Entity to update
  * \param stats : the structure we use to store statistics
@@ -123,7 +198,9 @@ void updateMentalMapEntity(Entity *entity, Statistics *stats);
 
 /**
  * \fn void updateFieldOfViewEntity(Field *aField, Entity *entity)
- * \brief function that update the field of view of an entity
+ * \brief function that update the field of view of an entity with the tiles of the field it can see in its vision range
+ * (see castFieldOfView). The tiles it can't see are FOG.
+ * The visible tiles which are FOG in the mental map are listed in revealedTiles
  *
  * \param entity : the Entity to update
  * \param field* : A pointer to the field on which we are based
@@ -197,6 +274,7 @@ void updateInterestField(InterestField* interestField, NeuralNetwork* neuralNetw
 /**
  * \fn void updateInterestField2(InterestField* interestField, int xEnd, int yEnd, Entity* entity, LabelingWeights* labelingWeights)
  * \brief function that change the values in an interest field according to the labelisation function
+ * The labeling is kept by the entity : only the tiles near the tiles of the mental map changed since the last call are labeled again
  *
  * \param InterestField* interestField : the interest field that will be update
  * \param int xEnd : x coordinate of the ending point
@@ -211,6 +289,7 @@ void updateInterestField2(InterestField* interestField, int xEnd, int yEnd, Enti
 /**
  * \fn void updateInterestField3(InterestField* interestField, Entity* entity, LabelingWeights* labelingWeights)
  * \brief function that change the values in an interest field according to the labelisation function
+ * The labeling is kept by the entity : only the tiles near the tiles of the mental map changed since the last call are labeled again
  *
  * \param InterestField* interestField : the interest field that will be update
  * \param Entity* entity : the entity on which we base the update of the interest field
@@ -233,6 +312,68 @@ void updateInterestField3(InterestField* interestField, Entity* entity, Labeling
  */
 void updateBestWantedPosition(node* wantedPosition, InterestField* interestField);
 
+/**
+ * \fn InterestRanking* initInterestRanking(int capacity)
+ * \brief function that creates an empty ranking of the tiles of an interest field
+ *
+ * \param capacity : the number of tiles of the interest fields that will be ranked
+ * \return InterestRanking*
+ */
+InterestRanking* initInterestRanking(int capacity);
+
+/**
+ * \fn void destructInterestRanking(InterestRanking** ranking)
+ * \brief function that free a ranking out of memory
+ *
+ * \param ranking : a double pointer on the ranking
+ * \return void
+ */
+void destructInterestRanking(InterestRanking** ranking);
+
+/**
+ * \fn void rankInterestField(InterestRanking* ranking, InterestField* interestField)
+ * \brief function that ranks all the tiles of an interest field, in a time linear with the number of tiles
+ * Must be called once per decision, after the interest field has been updated
+ *
+ * \param ranking : the ranking, with a capacity large enought for the interest field
+ * \param interestField : the interest field to rank
+ * \return void
+ */
+void rankInterestField(InterestRanking* ranking, InterestField* interestField);
+
+/**
+ * \fn void updateBestWantedPositionFromRanking(node* wantedPosition, InterestRanking* ranking)
+ * \brief function that change the coordinate of a node to the best coordinate which is still in a ranking,
+ * and removes it from the ranking. It gives the same positions, in the same order, as repeated calls of updateBestWantedPosition
+ * When there is no tile left, the node is set to (0, 0)
+ *
+ * \param node* wantedPosition : the node which will be updated to the next best position
+ * \param InterestRanking* ranking : the ranking of the interest field
+ * \return void
+ */
+void updateBestWantedPositionFromRanking(node* wantedPosition, InterestRanking* ranking);
+
+/**
+ * \fn node *findPathToCandidates(Entity *entity, node *startNode, node *wantedPosition, bool *endEvent)
+ * \brief function that finds a path to the first position the entity can reach, trying the wanted position
+ * and then the positions left in the ranking of the entity, from the best to the worst.
+ * With ASTAR_SEARCH, an A* search is made for each position which can be reached, the other ones are skipped
+ * after a flood of the mental map with a grid of bits. With FLOOD_SEARCH, the mental map is flooded once
+ * and the path is read from the flood, so the unreachable positions are skipped without any search.
+ * With INCREMENTAL_SEARCH, the wanted position is searched with the planner of the entity, which only repairs
+ * its distances where the mental map changed as long as the wanted position stays the same.
+ * With HIERARCHICAL_SEARCH, the positions are searched between the clusters of the mental map, and the path
+ * only goes to the first entrance on the way.
+ * The paths of the flood are shortest paths, so they can differ from the paths of the A* search.
+ *
+ * \param entity : the entity, whose ranking has been updated with rankInterestField
+ * \param startNode : the position of the entity
+ * \param wantedPosition : the first position to try, it is changed to the position the path goes to
+ * \param endEvent : pointer to boolean that will trigger the end of the function
+ * \return node* : the path, startNode if no position can be reached, NULL if the search has been interrupted
+ */
+node *findPathToCandidates(Entity *entity, node *startNode, node *wantedPosition, bool *endEvent);
+
 /**
  * \fn node *findNextPathNN(Entity *entity, node *startNode, node *endNode, dataType *data, NeuralNetwork *neuralNetwork)
  * \brief returns the next path chosen by a given neural network
@@ -284,47 +425,45 @@ node *findNextPathGN(Entity *entity, node *endNode, dataType *data, LabelingWeig
 node *findNextPathGN2(Entity *entity, dataType *data, LabelingWeights* labelingWeights);
 
 /**
- * \fn node* labeling2(Entity *entity, int xEnd, int yEnd, Field *field, dataType *data)
+ * \fn node* labeling2(Entity *entity, int xEnd, int yEnd, Field *field, uint64_t fieldKey)
  * \brief function that returns the expected choice for the neural network
+ * The shortest path to the destination is read from the distances to the destination kept by the shared distance cache,
+ * so they are only computed once for each field and destination
  *
  * \param entity : entity that is moving
  * \param xEnd, yEnd : coordinates of the destination
  * \param field : the complete field for the supervised learning
- * \param data : the structure we use to raise a flag for interruption
+ * \param fieldKey : the key of the field (see getFieldKey)
  * 
  * \return node*
  */
-node *labeling2(Entity *entity, int xEnd, int yEnd, Field *field, dataType *data);
+node *labeling2(Entity *entity, int xEnd, int yEnd, Field *field, uint64_t fieldKey);
 
 /**
- * \fn float labeling3(Field* fieldOfView, int xPosition, int yPosition, int xFinalPosition, int yFinalPosition, Entity* entity, LabelingWeights* labelingWeights)
- * \brief function that returns the labeling of the points
- * will be used for labelisation
+ * \fn double getLabelingBase3(LabelingFeatures* features, int xPosition, int yPosition, int xFinalPosition, int yFinalPosition, LabelingWeights* labelingWeights)
+ * \brief function that returns the labeling of a position with an end point, without the distance from the entity,
+ * which updateInterestField2 adds to it
  *
- * \param Field* fieldOfView : a field of view
+ * \param LabelingFeatures* features : the features of the field of view centered on the position
  * \param int xPosition : x coordinate of the center of the field of view
  * \param int yPosition : y coordinate of the center of the field of view
  * \param int xFinalPosition : x coordinate of the end point
  * \param int yFinalPosition : y coordinate of the end point
- * \param Entity* entity : the entity which uses the function to navigate (only use his coordiantes)
  * \param LabelingWeights* labelingWeights : Ze labeling weights
- * \return float
+ * \return double
  */
-float labeling3(Field* fieldOfView, int xPosition, int yPosition, int xFinalPosition, int yFinalPosition, Entity* entity, LabelingWeights* labelingWeights);
+double getLabelingBase3(LabelingFeatures* features, int xPosition, int yPosition, int xFinalPosition, int yFinalPosition, LabelingWeights* labelingWeights);
 
 /**
- * \fn float labeling4(Field* fieldOfView, int xPosition, int yPosition, Entity* entity, LabelingWeights* labelingWeights)
- * \brief function that returns the labeling of the points
- * will be used for labelisation
+ * \fn double getLabelingBase4(LabelingFeatures* features, LabelingWeights* labelingWeights)
+ * \brief function that returns the labeling of a position without an end point, without the distance from the entity,
+ * which updateInterestField3 adds to it
  *
- * \param Field* fieldOfView : a field of view
- * \param int xPosition : x coordinate of the center of the field of view
- * \param int yPosition : y coordinate of the center of the field of view
- * \param Entity* entity : the entity which uses the function to navigate (only use his coordiantes)
+ * \param LabelingFeatures* features : the features of the field of view centered on the position
  * \param LabelingWeights* labelingWeights : Ze labeling weights
- * \return float
+ * \return double
  */
-float labeling4(Field* fieldOfView, int xPosition, int yPosition, Entity* entity, LabelingWeights* labelingWeights);
+double getLabelingBase4(LabelingFeatures* features, LabelingWeights* labelingWeights);
 
 /**
  * \fn float* convertLabeling2(int fieldWidth, int fieldHeight, node *label)
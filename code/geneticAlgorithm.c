@@ -125,7 +125,7 @@ float labeling1(Field* fieldOfView, int xPosition, int yPosition, int xFinalPosi
     float value = 0;
     float finalValue = 0;
 
-    if (fieldOfView->data[(fieldOfView->height-1)/2][(fieldOfView->width-1)/2] != EMPTY) 
+    if (getFieldTile(fieldOfView, (fieldOfView->height-1)/2, (fieldOfView->width-1)/2) != EMPTY) 
     {
         return 0;
     }
@@ -134,7 +134,7 @@ float labeling1(Field* fieldOfView, int xPosition, int yPosition, int xFinalPosi
     {
         for(int height = 0; height < fieldOfView->height; height++)
         {
-            switch (fieldOfView->data[width][height])
+            switch (getFieldTile(fieldOfView, width, height))
             {
                 case EMPTY:
                     emptyPoint++;
@@ -31,12 +31,25 @@ int main(int argc, char** argv)
 		printf(" 4 pathGeneticNetwork [pathMap] : \n\tLoad an existing genetic network and test it on a random map or on an existing map\n\tTries to go to the bottom right\n");
 		printf(" 5 [pathGeneticNetwork] [pathMap] : \n\tStart a new genetic network and train it\n\tIt could be based on an existing map and be based on an existing genetic algorithm\n\tput \"NONE\" if you don't want to use any base genetic algorithm\n\tLearns to explore\n");
 	    printf(" 6 pathGeneticNetwork [pathMap] : \n\tLoad an existing genetic network and test it on a random map or on an existing map\n\tTries to explore\n");
+	    printf("The environment variable SEARCH_MODE chooses how the paths are searched : astar (default), flood, jps, incremental, hierarchical or bidirectional\n");
+	    printf("The environment variable HEURISTIC chooses the heuristic of the searches : manhattan (default), octile or landmark\n");
 	}
 	else
 	{
 		//Initialize the random seed value
 		srand(12345);
 		
+		//The way the paths are searched can be chosen with the environment variable SEARCH_MODE : astar (default), flood, jps, incremental, hierarchical or bidirectional
+		if(getenv("SEARCH_MODE") != NULL && !setSearchModeFromName(getenv("SEARCH_MODE")))
+		{
+			printf("Unknown search mode %s, astar is used\n", getenv("SEARCH_MODE"));
+		}
+		//The heuristic of the searches can be chosen with the environment variable HEURISTIC : manhattan (default), octile or landmark
+		if(getenv("HEURISTIC") != NULL && !setHeuristicModeFromName(getenv("HEURISTIC")))
+		{
+			printf("Unknown heuristic %s, manhattan is used\n", getenv("HEURISTIC"));
+		}
+		
 		const int tileSize = TILESIZE;
 		int windowWidth = 640;
 		int windowHeight = 480;
@@ -120,6 +133,13 @@ int main(int argc, char** argv)
 	        generateEnv(theField);
 	        fieldIsFromImage = false;
 	    }
+	    //The distances to the goals computed on the field by the previous runs are kept in a file next to its image
+	    char distanceFilePath[512] = "";
+	    if (fieldIsFromImage)
+	    {
+	        snprintf(distanceFilePath, sizeof(distanceFilePath), "%s%s", pathImageField, DISTANCE_FILE_EXTENSION);
+	        loadDistanceFields(getSharedDistanceCache(), theField, distanceFilePath);
+	    }
         fieldHeight = theField->height;
         fieldWidth = theField->width;
 		        
@@ -169,6 +189,10 @@ int main(int argc, char** argv)
 				break;
 		}
 		
+		//The distances computed on the field during the training are saved for the next runs
+		if (fieldIsFromImage && !saveDistanceFields(getSharedDistanceCache(), theField, distanceFilePath))
+		    printf("Unable to save file %s\n", distanceFilePath);
+		
 		SDL_ShowWindow(window);
 		
 		//--- Main loops
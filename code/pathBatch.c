@@ -0,0 +1,417 @@
+/**
+ * \file pathBatch.c
+ * \brief The batches of paths
+ * \version 0.1
+ * \date 17/10/2026
+ *
+ * Module that finds the paths of many (start, end) pairs on the same field at once.
+ * The queries with the same start share a single flood of the field, the grids of the searches are kept
+ * from one batch to the next, and all the paths are written one after the other in a single buffer.
+ * The batch can be split between several threads, each one with its own grid.
+ *
+ */
+
+//Header files containing the prototypes
+#include "pathBatch.h"
+
+/**
+ * \fn PathBatch* initPathBatch(void)
+ * \brief function that creates an empty batch of queries
+ *
+ * \return PathBatch*
+ */
+PathBatch* initPathBatch(void)
+{
+    PathBatch* batch = malloc(sizeof(PathBatch));
+    batch->queries = NULL;
+    batch->nbQueries = 0;
+    batch->capacityQueries = 0;
+    batch->order = NULL;
+    batch->nodes = NULL;
+    batch->nbNodes = 0;
+    batch->capacityNodes = 0;
+    batch->workers = NULL;
+    batch->nbWorkers = 0;
+    return batch;
+}
+
+/**
+ * \fn void destructPathBatch(PathBatch** batch)
+ * \brief function that free a batch, its paths and its grids out of memory
+ *
+ * \param batch : a double pointer on the batch
+ * \return void
+ */
+void destructPathBatch(PathBatch** batch)
+{
+    if(batch != NULL)
+    {
+        if(*batch != NULL)
+        {
+            int index;
+            for(index = 0; index < (*batch)->nbWorkers; index++)
+            {
+                destructSearchGrid(&((*batch)->workers[index].grid));
+                free((*batch)->workers[index].nodes);
+            }
+            free((*batch)->workers);
+            free((*batch)->queries);
+            free((*batch)->order);
+            free((*batch)->nodes);
+            free(*batch);
+            *batch = NULL;
+        }
+    }
+}
+
+/**
+ * \fn void clearPathBatch(PathBatch* batch)
+ * \brief function that removes all the queries and paths of a batch, but keeps its memory for the next queries
+ *
+ * \param batch : the batch
+ * \return void
+ */
+void clearPathBatch(PathBatch* batch)
+{
+    batch->nbQueries = 0;
+    batch->nbNodes = 0;
+}
+
+/**
+ * \fn int addQueryPathBatch(PathBatch* batch, int xStart, int yStart, int xEnd, int yEnd)
+ * \brief function that adds a (start, end) pair to a batch. Both must be inside the field of the batch
+ *
+ * \param batch : the batch
+ * \param xStart, yStart : the coordinate of the start
+ * \param xEnd, yEnd : the coordinate of the end
+ * \return int : the index of the query in the batch
+ */
+int addQueryPathBatch(PathBatch* batch, int xStart, int yStart, int xEnd, int yEnd)
+{
+    if(batch->nbQueries == batch->capacityQueries)
+    {
+        //We double the capacity so adding many queries stays linear
+        batch->capacityQueries = batch->capacityQueries * 2 + 16;
+        batch->queries = realloc(batch->queries, sizeof(PathQuery) * batch->capacityQueries);
+        batch->order = realloc(batch->order, sizeof(PathQuery*) * batch->capacityQueries);
+    }
+    PathQuery* query = &(batch->queries[batch->nbQueries]);
+    query->xStart = xStart;
+    query->yStart = yStart;
+    query->xEnd = xEnd;
+    query->yEnd = yEnd;
+    query->status = PATH_SEARCHING;
+    query->offset = 0;
+    query->length = 0;
+    batch->nbQueries++;
+    return batch->nbQueries - 1;
+}
+
+/**
+ * \fn static int compareQueries(const void* first, const void* second)
+ * \brief function used by qsort to sort the queries of a batch by start, and then in the order they were added
+ *
+ * \param first, second : pointers on the two pointers of queries to compare
+ * \return int : negative if the first query comes before the second one, positive otherwise
+ */
+static int compareQueries(const void* first, const void* second)
+{
+    const PathQuery* query1 = *(PathQuery* const*)first;
+    const PathQuery* query2 = *(PathQuery* const*)second;
+    if(query1->yStart != query2->yStart)
+    {
+        return query1->yStart - query2->yStart;
+    }
+    if(query1->xStart != query2->xStart)
+    {
+        return query1->xStart - query2->xStart;
+    }
+    //The queries come from the same array, so their addresses give the order in which they were added
+    if(query1 < query2)
+    {
+        return -1;
+    }
+    return 1;
+}
+
+/**
+ * \fn static bool haveSameStart(const PathQuery* query1, const PathQuery* query2)
+ * \brief function which check if two queries start from the same tile
+ *
+ * \param query1, query2 : the queries
+ * \return bool
+ */
+static bool haveSameStart(const PathQuery* query1, const PathQuery* query2)
+{
+    return query1->xStart == query2->xStart && query1->yStart == query2->yStart;
+}
+
+/**
+ * \fn static void writePathWorker(PathBatchWorker* worker, PathQuery* query, node* endNode)
+ * \brief function that copies the path found for a query from the grid of a thread to the buffer of the thread
+ *
+ * \param worker : the part of the batch of the thread, whose grid reached the end of the query
+ * \param query : the query
+ * \param endNode : the end of the query
+ * \return void
+ */
+static void writePathWorker(PathBatchWorker* worker, PathQuery* query, node* endNode)
+{
+    int length = getPathLengthFromGrid(worker->grid, endNode->x, endNode->y);
+    if(worker->nbNodes + length > worker->capacityNodes)
+    {
+        worker->capacityNodes = worker->capacityNodes * 2 + length;
+        worker->nodes = realloc(worker->nodes, sizeof(node) * worker->capacityNodes);
+    }
+    //The links written here point in the buffer of the thread, they are set again once copied in the batch
+    writePathFromGrid(worker->grid, endNode, worker->nodes + worker->nbNodes, length);
+    query->status = PATH_FOUND;
+    query->offset = worker->nbNodes;
+    query->length = length;
+    worker->nbNodes += length;
+}
+
+/**
+ * \fn static void* findPathsWorker(void* arg)
+ * \brief function that finds the paths of the queries given to a thread, one group of queries with the same start after another
+ *
+ * \param arg : the part of the batch of the thread (PathBatchWorker*)
+ * \return void* : NULL
+ */
+static void* findPathsWorker(void* arg)
+{
+    PathBatchWorker* worker = arg;
+    PathQuery** order = worker->batch->order;
+    int first = worker->first;
+    worker->nbNodes = 0;
+    while(first < worker->last && (worker->endEvent == NULL || *(worker->endEvent) == false))
+    {
+        //The queries with the same start follow each other in the sorted queries
+        int last = first + 1;
+        while(last < worker->last && haveSameStart(order[first], order[last]))
+        {
+            last++;
+        }
+        node startNode = {order[first]->xStart, order[first]->yStart, 0, 0, NULL};
+        int index;
+        if(last - first >= PATH_BATCH_FLOOD_THRESHOLD)
+        {
+            //A single flood from the start gives the paths to all the ends of the group
+            floodSearchGrid(worker->grid, &startNode, worker->theField);
+            for(index = first; index < last; index++)
+            {
+                node endNode = {order[index]->xEnd, order[index]->yEnd, 0, 0, NULL};
+                if(isReachedSearchGrid(worker->grid, endNode.x, endNode.y))
+                {
+                    writePathWorker(worker, order[index], &endNode);
+                }
+                else
+                {
+                    order[index]->status = PATH_NOT_FOUND;
+                }
+            }
+        }
+        else
+        {
+            for(index = first; index < last; index++)
+            {
+                node endNode = {order[index]->xEnd, order[index]->yEnd, 0, 0, NULL};
+                pathStatusEnum status = findPathOnSearchGrid(&startNode, &endNode, worker->theField, worker->endEvent, worker->grid);
+                if(status == PATH_FOUND)
+                {
+                    writePathWorker(worker, order[index], &endNode);
+                }
+                else
+                {
+                    //An interrupted search leaves the query at PATH_SEARCHING
+                    order[index]->status = status;
+                }
+            }
+        }
+        first = last;
+    }
+    return NULL;
+}
+
+/**
+ * \fn static int splitPathBatch(PathBatch* batch, Field* theField, int nbThreads, bool* endEvent)
+ * \brief function that splits the sorted queries of a batch between its workers, without splitting a group of queries
+ * with the same start, and gives each worker a grid of the dimension of the field
+ *
+ * \param batch : the batch, whose queries are sorted
+ * \param theField : the field of the queries
+ * \param nbThreads : the number of workers wanted
+ * \param endEvent : pointer to boolean that will trigger the end of the search
+ * \return int : the number of workers used, from the first one
+ */
+static int splitPathBatch(PathBatch* batch, Field* theField, int nbThreads, bool* endEvent)
+{
+    int nbWorkers = nbThreads;
+    if(nbWorkers > PATH_BATCH_MAX_THREADS)
+    {
+        nbWorkers = PATH_BATCH_MAX_THREADS;
+    }
+    if(nbWorkers > batch->nbQueries)
+    {
+        nbWorkers = batch->nbQueries;
+    }
+    if(nbWorkers < 1)
+    {
+        nbWorkers = 1;
+    }
+    if(nbWorkers > batch->nbWorkers)
+    {
+        batch->workers = realloc(batch->workers, sizeof(PathBatchWorker) * nbWorkers);
+        int index;
+        for(index = batch->nbWorkers; index < nbWorkers; index++)
+        {
+            batch->workers[index].grid = NULL;
+            batch->workers[index].nodes = NULL;
+            batch->workers[index].capacityNodes = 0;
+        }
+        batch->nbWorkers = nbWorkers;
+    }
+
+    int first = 0;
+    int index;
+    for(index = 0; index < nbWorkers; index++)
+    {
+        PathBatchWorker* worker = &(batch->workers[index]);
+        //We only allocate a grid again when the dimension of the field changed
+        if(worker->grid == NULL || worker->grid->width != theField->width || worker->grid->height != theField->height)
+        {
+            destructSearchGrid(&(worker->grid));
+            worker->grid = initSearchGrid(theField->width, theField->height);
+        }
+        int last = (index + 1) * batch->nbQueries / nbWorkers;
+        if(last < first)
+        {
+            last = first;
+        }
+        //The group of queries with the same start at the end of the range stays with this worker
+        while(last > 0 && last < batch->nbQueries && haveSameStart(batch->order[last - 1], batch->order[last]))
+        {
+            last++;
+        }
+        worker->first = first;
+        worker->last = last;
+        worker->nbNodes = 0;
+        worker->batch = batch;
+        worker->theField = theField;
+        worker->endEvent = endEvent;
+        first = last;
+    }
+    return nbWorkers;
+}
+
+/**
+ * \fn int findPathsPathBatch(PathBatch* batch, Field* theField, int nbThreads, bool* endEvent)
+ * \brief function that finds the paths of all the queries of a batch, with the current search mode.
+ * The queries with at least PATH_BATCH_FLOOD_THRESHOLD ends for the same start are answered by a single flood
+ * from the start, so their paths are shortest paths which can differ from the ones of the search mode.
+ * The paths of a previous call are overwritten
+ *
+ * \param batch : the batch
+ * \param theField : the field used to see where the paths can go, which must not change during the call
+ * \param nbThreads : the number of threads among which the queries are split, 1 to find them in the calling thread
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \return int : the number of queries for which a path has been found
+ */
+int findPathsPathBatch(PathBatch* batch, Field* theField, int nbThreads, bool* endEvent)
+{
+    int index;
+    batch->nbNodes = 0;
+    if(batch->nbQueries == 0)
+    {
+        return 0;
+    }
+    for(index = 0; index < batch->nbQueries; index++)
+    {
+        batch->queries[index].status = PATH_SEARCHING;
+        batch->queries[index].offset = 0;
+        batch->queries[index].length = 0;
+        batch->order[index] = &(batch->queries[index]);
+    }
+    qsort(batch->order, batch->nbQueries, sizeof(PathQuery*), compareQueries);
+    int nbWorkers = splitPathBatch(batch, theField, nbThreads, endEvent);
+
+    //The first worker runs in the calling thread, the other ones in their own thread
+    pthread_t threads[PATH_BATCH_MAX_THREADS];
+    bool isStarted[PATH_BATCH_MAX_THREADS];
+    for(index = 1; index < nbWorkers; index++)
+    {
+        isStarted[index] = pthread_create(&threads[index], NULL, findPathsWorker, &(batch->workers[index])) == 0;
+        if(!isStarted[index])
+        {
+            //If the thread can't be created, its queries are searched by the calling thread
+            findPathsWorker(&(batch->workers[index]));
+        }
+    }
+    findPathsWorker(&(batch->workers[0]));
+    for(index = 1; index < nbWorkers; index++)
+    {
+        if(isStarted[index])
+        {
+            pthread_join(threads[index], NULL);
+        }
+    }
+
+    //We copy the paths of the workers one after the other in the buffer of the batch
+    int nbNodes = 0;
+    for(index = 0; index < nbWorkers; index++)
+    {
+        nbNodes += batch->workers[index].nbNodes;
+    }
+    if(nbNodes > batch->capacityNodes)
+    {
+        batch->capacityNodes = nbNodes;
+        free(batch->nodes);
+        batch->nodes = malloc(sizeof(node) * batch->capacityNodes);
+    }
+    int nbFound = 0;
+    for(index = 0; index < nbWorkers; index++)
+    {
+        PathBatchWorker* worker = &(batch->workers[index]);
+        if(worker->nbNodes > 0)
+        {
+            memcpy(batch->nodes + batch->nbNodes, worker->nodes, sizeof(node) * worker->nbNodes);
+        }
+        int rank;
+        for(rank = worker->first; rank < worker->last; rank++)
+        {
+            PathQuery* query = batch->order[rank];
+            if(query->status == PATH_FOUND)
+            {
+                query->offset += batch->nbNodes;
+                //The nodes of the path are linked again in the buffer of the batch
+                int step;
+                for(step = 0; step < query->length - 1; step++)
+                {
+                    batch->nodes[query->offset + step].linkedNode = &(batch->nodes[query->offset + step + 1]);
+                }
+                batch->nodes[query->offset + query->length - 1].linkedNode = NULL;
+                nbFound++;
+            }
+        }
+        batch->nbNodes += worker->nbNodes;
+    }
+    return nbFound;
+}
+
+/**
+ * \fn node* getPathFromPathBatch(PathBatch* batch, int index)
+ * \brief function that returns the path found for a query of a batch, from the start to the end.
+ * The nodes belong to the buffer of the batch, they must not be freed and are kept until the next call to findPathsPathBatch
+ *
+ * \param batch : the batch
+ * \param index : the index of the query
+ * \return node* : the path, NULL if none was found
+ */
+node* getPathFromPathBatch(PathBatch* batch, int index)
+{
+    if(batch->queries[index].status != PATH_FOUND)
+    {
+        return NULL;
+    }
+    return &(batch->nodes[batch->queries[index].offset]);
+}
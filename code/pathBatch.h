@@ -0,0 +1,136 @@
+/**
+ * \file pathBatch.h
+ * \brief Prototypes of the batches of paths
+ * \version 0.1
+ * \date 17/10/2026
+ *
+ * Module that finds the paths of many (start, end) pairs on the same field at once.
+ * The queries with the same start share a single flood of the field, the grids of the searches are kept
+ * from one batch to the next, and all the paths are written one after the other in a single buffer.
+ * The batch can be split between several threads, each one with its own grid.
+ *
+ */
+
+#ifndef H_PATHBATCH
+    #define H_PATHBATCH
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include "prototype.h"
+#include "pathfinding.h"
+
+//The number of queries with the same start from which the field is flooded once from the start
+//instead of making a search for each query
+#ifndef PATH_BATCH_FLOOD_THRESHOLD
+    #define PATH_BATCH_FLOOD_THRESHOLD (3)
+#endif
+
+//The maximum number of threads used to find the paths of a batch
+#ifndef PATH_BATCH_MAX_THREADS
+    #define PATH_BATCH_MAX_THREADS (16)
+#endif
+
+//A (start, end) pair of a batch and the path found for it
+typedef struct PathQuery
+{
+    int xStart, yStart;
+    int xEnd, yEnd;
+    //PATH_FOUND, PATH_NOT_FOUND, or PATH_SEARCHING if the batch was interrupted before the query was done
+    pathStatusEnum status;
+    int offset; //The index of the first node of the path in the buffer of the batch
+    int length; //The number of nodes of the path, 0 if none was found
+}PathQuery;
+
+//The part of a batch given to a thread, with the memory it keeps from one batch to the next
+typedef struct PathBatchWorker
+{
+    SearchGrid* grid; //The grid of the searches and floods of the thread
+    node* nodes; //The paths found by the thread, before they are copied in the buffer of the batch
+    int nbNodes;
+    int capacityNodes;
+    int first, last; //The range of the sorted queries given to the thread
+    struct PathBatch* batch;
+    Field* theField;
+    bool* endEvent;
+}PathBatchWorker;
+
+//Structure of a batch of queries on the same field
+typedef struct PathBatch
+{
+    PathQuery* queries;
+    int nbQueries;
+    int capacityQueries;
+    PathQuery** order; //The queries sorted by start, so the queries with the same start follow each other
+    node* nodes; //The paths of all the queries one after the other, each one linked like a chain list
+    int nbNodes;
+    int capacityNodes;
+    PathBatchWorker* workers;
+    int nbWorkers;
+}PathBatch;
+
+/**
+ * \fn PathBatch* initPathBatch(void)
+ * \brief function that creates an empty batch of queries
+ *
+ * \return PathBatch*
+ */
+PathBatch* initPathBatch(void);
+
+/**
+ * \fn void destructPathBatch(PathBatch** batch)
+ * \brief function that free a batch, its paths and its grids out of memory
+ *
+ * \param batch : a double pointer on the batch
+ * \return void
+ */
+void destructPathBatch(PathBatch** batch);
+
+/**
+ * \fn void clearPathBatch(PathBatch* batch)
+ * \brief function that removes all the queries and paths of a batch, but keeps its memory for the next queries
+ *
+ * \param batch : the batch
+ * \return void
+ */
+void clearPathBatch(PathBatch* batch);
+
+/**
+ * \fn int addQueryPathBatch(PathBatch* batch, int xStart, int yStart, int xEnd, int yEnd)
+ * \brief function that adds a (start, end) pair to a batch. Both must be inside the field of the batch
+ *
+ * \param batch : the batch
+ * \param xStart, yStart : the coordinate of the start
+ * \param xEnd, yEnd : the coordinate of the end
+ * \return int : the index of the query in the batch
+ */
+int addQueryPathBatch(PathBatch* batch, int xStart, int yStart, int xEnd, int yEnd);
+
+/**
+ * \fn int findPathsPathBatch(PathBatch* batch, Field* theField, int nbThreads, bool* endEvent)
+ * \brief function that finds the paths of all the queries of a batch, with the current search mode.
+ * The queries with at least PATH_BATCH_FLOOD_THRESHOLD ends for the same start are answered by a single flood
+ * from the start, so their paths are shortest paths which can differ from the ones of the search mode.
+ * The paths of a previous call are overwritten
+ *
+ * \param batch : the batch
+ * \param theField : the field used to see where the paths can go, which must not change during the call
+ * \param nbThreads : the number of threads among which the queries are split, 1 to find them in the calling thread
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \return int : the number of queries for which a path has been found
+ */
+int findPathsPathBatch(PathBatch* batch, Field* theField, int nbThreads, bool* endEvent);
+
+/**
+ * \fn node* getPathFromPathBatch(PathBatch* batch, int index)
+ * \brief function that returns the path found for a query of a batch, from the start to the end.
+ * The nodes belong to the buffer of the batch, they must not be freed and are kept until the next call to findPathsPathBatch
+ *
+ * \param batch : the batch
+ * \param index : the index of the query
+ * \return node* : the path, NULL if none was found
+ */
+node* getPathFromPathBatch(PathBatch* batch, int index);
+
+#endif
@@ -12,6 +12,18 @@
 //Header files containing the prototypes
 #include "pathfinding.h"
 
+//The number of nodes allocated one by one with initNode
+static long nbNodeAllocations = 0;
+
+//The way the entities search their paths, see setSearchMode
+static searchModeEnum searchMode = DEFAULT_SEARCH_MODE;
+
+//The heuristic of the A* algorithme, see setHeuristicMode
+static heuristicEnum heuristicMode = DEFAULT_HEURISTIC;
+
+//The landmarks used by LANDMARK_HEURISTIC, see useLandmarks
+static const Landmarks* activeLandmarks = NULL;
+
 /**
  * \fn node* initNode(int x, int y, int cost, int heuristic)
  * \brief function that initialise a node. A node is a structure used in the A* algorithme
@@ -26,6 +38,105 @@
 node* initNode(int x, int y, int cost, int heuristic)
 {
 	node* newNode = malloc(sizeof(node));
+	nbNodeAllocations++;
+	newNode->x = x;
+	newNode->y = y;
+	newNode->cost = cost;
+	newNode->heuristic = heuristic;
+	newNode->linkedNode = NULL;
+	return newNode;
+}
+
+/**
+ * \fn long getNbNodeAllocations(void)
+ * \brief function that returns the number of nodes allocated one by one with initNode since the start of the program
+ * The nodes taken from a pool of nodes are not counted
+ *
+ * \return long
+ */
+long getNbNodeAllocations(void)
+{
+	return nbNodeAllocations;
+}
+
+/**
+ * \fn NodePool* initNodePool(void)
+ * \brief function that initialise an empty pool of nodes
+ *
+ * \return NodePool*
+ */
+NodePool* initNodePool(void)
+{
+	NodePool* pool = malloc(sizeof(NodePool));
+	pool->nbBlocks = 0;
+	pool->capacityBlocks = 8;
+	pool->blocks = malloc(sizeof(node*) * pool->capacityBlocks);
+	pool->currentBlock = 0;
+	pool->currentIndex = 0;
+	pool->nbNodesServed = 0;
+	return pool;
+}
+
+/**
+ * \fn void destructNodePool(NodePool** pool)
+ * \brief function used to free a pool of nodes and all the nodes taken from it
+ *
+ * \param pool : a double pointer to the pool to free
+ * \return void
+ */
+void destructNodePool(NodePool** pool)
+{
+	if(pool != NULL)
+	{
+		if(*pool != NULL)
+		{
+			int index;
+			for(index = 0; index < (*pool)->nbBlocks; index++)
+			{
+				free((*pool)->blocks[index]);
+			}
+			free((*pool)->blocks);
+			free(*pool);
+			*pool = NULL;
+		}
+	}
+}
+
+/**
+ * \fn node* allocNodePool(NodePool* pool, int x, int y, int cost, int heuristic)
+ * \brief function that initialise a node taken from a pool of nodes. The node must not be freed on its own,
+ * it is given back to the pool when the pool is reset
+ *
+ * \param pool : the pool from which the node is taken
+ * \param x, y : the coordinate of the node
+ * \param cost : the number of step since the starting node
+ * \param heuristic : the cost + the distance between the ending node and the node initialized
+ * \return node*
+ */
+node* allocNodePool(NodePool* pool, int x, int y, int cost, int heuristic)
+{
+	//If the current block is full, we go to the next one
+	if(pool->currentIndex == NODE_POOL_BLOCK_SIZE)
+	{
+		pool->currentBlock++;
+		pool->currentIndex = 0;
+	}
+	//If the pool has no block left, we allocate a new one
+	if(pool->currentBlock == pool->nbBlocks)
+	{
+		if(pool->nbBlocks == pool->capacityBlocks)
+		{
+			pool->capacityBlocks *= 2;
+			pool->blocks = realloc(pool->blocks, sizeof(node*) * pool->capacityBlocks);
+		}
+		pool->blocks[pool->nbBlocks] = malloc(sizeof(node) * NODE_POOL_BLOCK_SIZE);
+		pool->nbBlocks++;
+	}
+
+	node* newNode = &pool->blocks[pool->currentBlock][pool->currentIndex];
+	pool->currentIndex++;
+	pool->nbNodesServed++;
+
 	newNode->x = x;
 	newNode->y = y;
 	newNode->cost = cost;
@@ -35,53 +146,99 @@ node* initNode(int x, int y, int cost, int heuristic)
 }
 
 /**
- * \fn node* nearestNode(Field *oneField, int x, int y)
+ * \fn void resetNodePool(NodePool* pool)
+ * \brief function that gives back all the nodes taken from a pool at once, without freeing its blocks
+ *
+ * \param pool : the pool to reset
+ * \return void
+ */
+void resetNodePool(NodePool* pool)
+{
+	pool->currentBlock = 0;
+	pool->currentIndex = 0;
+}
+
+/**
+ * \fn static bool isNearestNodeTile(const Field *oneField, int x, int y)
+ * \brief function that returns true if a tile is inside the field and a path can go through it
+ *
+ * \param oneField : the field
+ * \param x, y : the coordinates of the tile
+ * \return bool
+ */
+static bool isNearestNodeTile(const Field *oneField, int x, int y)
+{
+	if((x >= 0) && (x < oneField->width) && (y >= 0) && (y <  oneField->height))
+	{
+		return getFieldTile(oneField, x, y) == EMPTY || getFieldTile(oneField, x, y) == VISITED;
+	}
+	return false;
+}
+
+/**
+ * \fn node* nearestNode(const Field *oneField, int x, int y)
  * \brief function that return the nearest and safest node around the node which is used as a starting point for the pathfinding
  * But this node can be a WALL. A node is a structure used in the A* algorithme
  * A node can be used to create a chain list of node
+ * Only the border of each growing square around the node is read, and the search stops at the first square with a walkable tile.
+ * If the field has no tile a path can go through, the node is at the given coordinates
  *
  * \param x, y : the coordinates of the node used as a starting point for the pathfinding
  * \param oneField* : poiter to the field in which we search a safe node
  * \return node*
  */
-node* nearestNode(Field *oneField, int x, int y)
+node* nearestNode(const Field *oneField, int x, int y)
 {
-	int xNode = x;
-	int yNode = y;
 	int i;
 	int j;
-	int neighboursOrder = 1;
-	bool findNode = false;
+	int neighboursOrder;
 
-	if((x >= 0) && (x < oneField->width) && (y >= 0) && (y <  oneField->height))
+	if(isNearestNodeTile(oneField, x, y))
 	{
-		if(oneField->data[x][y] == EMPTY || oneField->data[x][y] == VISITED)
-		{
-			return initNode(x, y, 0, 0);
-		}
+		return initNode(x, y, 0, 0);
+	}
+	//Beyond this order, the square covers the whole field
+	int maxOrder = x;
+	if(oneField->width - 1 - x > maxOrder)
+	{
+		maxOrder = oneField->width - 1 - x;
+	}
+	if(y > maxOrder)
+	{
+		maxOrder = y;
 	}
-	while(findNode == false)
+	if(oneField->height - 1 - y > maxOrder)
 	{
-		for(i = (x-neighboursOrder); i <= (x+neighboursOrder); i++)
+		maxOrder = oneField->height - 1 - y;
+	}
+	for(neighboursOrder = 1; neighboursOrder <= maxOrder; neighboursOrder++)
+	{
+		//The tiles of the smaller squares aren't walkable, so we only read the border of the square.
+		//The chosen tile is the one with the greatest x, and then the greatest y, so we read them in this order
+		for(i = (x+neighboursOrder); i >= (x-neighboursOrder); i--)
 		{
-			for(j = (y-neighboursOrder); j <= (y+neighboursOrder); j++)
+			if(i == (x+neighboursOrder) || i == (x-neighboursOrder))
 			{
-				if((i >= 0) && (i < oneField->width) && (j >= 0) && (j <  oneField->height))
+				for(j = (y+neighboursOrder); j >= (y-neighboursOrder); j--)
 				{
-					if(oneField->data[i][j] == EMPTY || oneField->data[i][j] == VISITED)
+					if(isNearestNodeTile(oneField, i, j))
 					{
-						xNode = i;
-						yNode = j;
-						findNode = true;
+						return initNode(i, j, 0, 0);
 					}
 				}
 			}
+			else if(isNearestNodeTile(oneField, i, y+neighboursOrder))
+			{
+				return initNode(i, y+neighboursOrder, 0, 0);
+			}
+			else if(isNearestNodeTile(oneField, i, y-neighboursOrder))
+			{
+				return initNode(i, y-neighboursOrder, 0, 0);
+			}
 		}
+	}
 
-		neighboursOrder++;
-	}	
-
-	return initNode(xNode, yNode, 0, 0);
+	return initNode(x, y, 0, 0);
 }
 
 /**
@@ -340,17 +497,60 @@ int nodeCmp(node* n1, node* n2)
 	}
 }
 
+/**
+ * \fn static int estimateDistance(int x, int y, int xEnd, int yEnd)
+ * \brief function which return the distance between two tiles estimated with the heuristic chosen by setHeuristicMode
+ * Only integers are used, and the distance is never above the number of steps of a path between the two tiles
+ * 
+ * \param x, y : the coordinate of the first tile
+ * \param xEnd, yEnd : the coordinate of the second tile
+ * \return int
+ */
+static int estimateDistance(int x, int y, int xEnd, int yEnd)
+{
+	int dx = abs(xEnd - x);
+	int dy = abs(yEnd - y);
+	if(heuristicMode == OCTILE_HEURISTIC)
+	{
+		//The octile distance is max + (sqrt(2) - 1) * min, we use 2/5 instead of sqrt(2) - 1 to stay below it
+		if(dx > dy)
+		{
+			return dx + (2 * dy) / 5;
+		}
+		return dy + (2 * dx) / 5;
+	}
+
+	//The manhattan distance is the number of steps without any wall
+	int estimate = dx + dy;
+	if(heuristicMode == LANDMARK_HEURISTIC && activeLandmarks != NULL && activeLandmarks->isValid)
+	{
+		const int* distance = &activeLandmarks->distance[(y * activeLandmarks->width + x) * NB_LANDMARKS];
+		const int* endDistance = &activeLandmarks->distance[(yEnd * activeLandmarks->width + xEnd) * NB_LANDMARKS];
+		int landmark;
+		for(landmark = 0; landmark < activeLandmarks->nbLandmarks; landmark++)
+		{
+			//With the triangle inequality, the distance between the tiles is at least the difference of their distances to the landmark
+			if(distance[landmark] != INFINITE_DISTANCE && endDistance[landmark] != INFINITE_DISTANCE &&
+			   abs(endDistance[landmark] - distance[landmark]) > estimate)
+			{
+				estimate = abs(endDistance[landmark] - distance[landmark]);
+			}
+		}
+	}
+	return estimate;
+}
+
 /**
  * \fn int distNodes(node* n1, node* n2)
- * \brief function which return the square of the distance between the two given nodes
+ * \brief function which return the distance between the two given nodes estimated with the heuristic chosen by setHeuristicMode
+ * The distance is never above the number of steps of a path between the two nodes
  * 
  * \param n1, n2 : the two nodes between which we want to know the distance
  * \return int
  */
 int distNodes(node* n1, node* n2)
 {
-	//Using Pythagor's theorem we calculate the square of the distance between the two nodes
-	return pow((n1->x - n2->x), 2) + pow((n1->y - n2->y), 2);
+	return estimateDistance(n2->x, n2->y, n1->x, n1->y);
 }
 
 /**
@@ -433,71 +633,93 @@ node* getLowestNode(node** openSet)
 }
 
 /**
- * \fn node* getPath(node** closedSet, node* endNode)
- * \brief function which create a chain list of nodes which represent the obtimised path
- * using the closedSet of a A* algorithme
+ * \fn int getPathLengthFromGrid(SearchGrid* grid, int xEnd, int yEnd)
+ * \brief function which returns the number of nodes of the path found by a search, by following the parents
+ * from the end tile back to the start tile
  * 
- * \param closedSet : the chain list of nodes which represent the closeSet of the A* algorithme
+ * \param grid : the grid of the search which reached the end tile
+ * \param xEnd, yEnd : the coordinate of the end tile
+ * \return int
+ */
+int getPathLengthFromGrid(SearchGrid* grid, int xEnd, int yEnd)
+{
+	int length = 0;
+	int tile = yEnd * grid->width + xEnd;
+	//We go back from parent to parent until we reach the start tile
+	while(tile != -1)
+	{
+		length++;
+		tile = grid->parent[tile];
+	}
+	return length;
+}
+
+/**
+ * \fn node* getPathFromGrid(SearchGrid* grid, node* endNode)
+ * \brief function which create a chain list of nodes which represent the path found by a search,
+ * using the parents recorded in its grid. Each node of the chain list is allocated
+ * 
+ * \param grid : the grid of the search which reached the end node
  * \param endNode : the end node of the A* algorithme
  * \return node*
  */
-node* getPath(node** closedSet, node* endNode)
+node* getPathFromGrid(SearchGrid* grid, node* endNode)
 {
-	//First we create a chain list wich will contain the path
 	node* path = NULL;
-	node* cursor = *closedSet;
-	node* temp = endNode;
-	//This variable is used to keep track of the current cost we are searching
-	int currentCost = 0;
-
-	//We begin by searching in the closedSet the node which is at the end poitn coordinate
-	while(cursor != NULL)
+	//The cost of the end node is the number of steps since the start
+	int cost = getPathLengthFromGrid(grid, endNode->x, endNode->y) - 1;
+	int tile = endNode->y * grid->width + endNode->x;
+	//We insert the nodes from the end to the start, so the start ends up on top of the chain list
+	while(tile != -1)
 	{
-		if(cursor->x == temp->x && cursor->y == temp->y)
-		{
-			//Once find, we save this node for later
-			temp = cursor;
-			//And we update the current cost
-			currentCost = temp->cost;
-			break;
-		}
-		cursor = cursor->linkedNode;
+		node* temp = initNode(tile % grid->width, tile / grid->width, cost, 0);
+		setHeuristic(temp, endNode);
+		insertFrontNode(&path, temp);
+		cost--;
+		tile = grid->parent[tile];
 	}
-	//We insert a copy of this node to our path
-	insertFrontNode(&path, cpyNode(temp));
+	return path;
+}
 
-	//Then, while the cost as still not reach 0 (understand : we didn't backtrack to the starting point yet)
-	while(currentCost > 0)
+/**
+ * \fn int writePathFromGrid(SearchGrid* grid, node* endNode, node* pathBuffer, int bufferSize)
+ * \brief function which write the path found by a search in a contiguous buffer, from the start to the end,
+ * using the parents recorded in its grid. The nodes of the buffer are linked to each other like a chain list,
+ * so the buffer can be read like a path but must not be freed node by node
+ * 
+ * \param grid : the grid of the search which reached the end node
+ * \param endNode : the end node of the A* algorithme
+ * \param pathBuffer : the buffer in which the path is written
+ * \param bufferSize : the number of nodes the buffer can hold
+ * \return int : the number of nodes of the path. If it is greater than bufferSize, nothing is written
+ */
+int writePathFromGrid(SearchGrid* grid, node* endNode, node* pathBuffer, int bufferSize)
+{
+	int length = getPathLengthFromGrid(grid, endNode->x, endNode->y);
+	if(pathBuffer != NULL && length <= bufferSize)
 	{
-		//We check in all the chain list for a node with a cost directly inferior to the current cost
-		//And next to the last node added to the path
-		cursor = *closedSet;
-		while(cursor != NULL)
+		int index = length - 1;
+		int tile = endNode->y * grid->width + endNode->x;
+		//We fill the buffer from its end, the cost of each node being its index in the path
+		while(tile != -1)
 		{
-			if(cursor->cost == currentCost - 1 && isNextTo(cursor, temp->x, temp->y))
+			pathBuffer[index].x = tile % grid->width;
+			pathBuffer[index].y = tile / grid->width;
+			pathBuffer[index].cost = index;
+			setHeuristic(&pathBuffer[index], endNode);
+			if(index == length - 1)
+			{
+				pathBuffer[index].linkedNode = NULL;
+			}
+			else
 			{
-				//Once find we save the node for later
-				temp = cursor;
-				//And we update the cost
-				currentCost--;
-				/*And most importantly, we stop the loop
-				Their is usually different nodes who correspond to this description and we want only one of them
-				All these nodes are equivalent if we want the most optimize path*/
-				break;
+				pathBuffer[index].linkedNode = &pathBuffer[index + 1];
 			}
-			cursor = cursor->linkedNode;
+			index--;
+			tile = grid->parent[tile];
 		}
-		//Then we insert the node into the path
-		insertFrontNode(&path, cpyNode(temp));
 	}
-	//Finaly we return the path
-	return path;
-	/*The logic behind the reconstruction of the path is simple : 
-	-we start with the last node of the path
-	-we find a neighbour with a cost directly inferior of the last added node
-	-we add it
-	-repeat until the cost reaches 0
-	*/
+	return length;
 }
 
 /**
@@ -526,149 +748,2136 @@ node* getNode(node** path, int index)
 }
 
 /**
- * \fn void addNeighbors(node** openSet, node** closedSet, node* currentNode, node* endNode, Field *theField)
- * \brief function which adds and create the neighboors of a given node in the openSet of the A* algorithme
- * It adds neighbors only if they are not in the closedSet or the openSet
- * 
- * \param openSet : the chain list of nodes which represent the openSet of the A* algorithme
- * \param closedSet : the chain list of nodes which represent the closeSet of the A* algorithme
- * \param currentNode : the reference node used to create the neighbors
- * \param endNode : the end node of the A* algorithme
- * \param theField* : poiter to the field used to see if it is a valid neighbor or not
+ * \fn SearchGrid* initSearchGrid(int width, int height)
+ * \brief function that initialise the membership grid of the A* algorithme for a field of the given dimension
+ *
+ * \param width, height : the dimension of the field on which the A* algorithme will be used
+ * \return SearchGrid*
+ */
+SearchGrid* initSearchGrid(int width, int height)
+{
+	SearchGrid* grid = malloc(sizeof(SearchGrid));
+	grid->width = width;
+	grid->height = height;
+	grid->generation = 1;
+	//A stamp at 0 is never equal to the generation, so no tile is in a set at first
+	grid->openStamp = calloc(width * height, sizeof(uint32_t));
+	grid->closedStamp = calloc(width * height, sizeof(uint32_t));
+	grid->position = malloc(sizeof(int) * width * height);
+	grid->parent = malloc(sizeof(int) * width * height);
+	grid->distance = malloc(sizeof(int) * width * height);
+	grid->queue = malloc(sizeof(int) * width * height);
+	grid->pool = initNodePool();
+	grid->reverse = NULL;
+	return grid;
+}
+
+/**
+ * \fn void destructSearchGrid(SearchGrid** grid)
+ * \brief function used to free a membership grid
+ *
+ * \param grid : a double pointer to the grid to free
  * \return void
  */
-void addNeighbors(node** openSet, node** closedSet, node* currentNode, node* endNode, Field *theField)
+void destructSearchGrid(SearchGrid** grid)
 {
-	int x = currentNode->x;
-	int y = currentNode->y;
-	node* temp;
-	
-	/*For each neighbors we check if :
-	-It is inside of the field
-	-It is not in the closed or open set
-	-It is in an empty tile
-	*/
-	if (x-1 >= 0 && !isInSet(closedSet, x-1, y) && !isInSet(openSet, x-1, y) && 
-	    (theField->data[x-1][y] == EMPTY || theField->data[x-1][y] == VISITED))
-	{
-		//If everything is verify we create it
-		temp = initNode(x-1, y, currentNode->cost + 1, 0);
-		//We set his heuristic
-		setHeuristic(temp, endNode);
-		//We insert it in the openSet
-		insertFrontNode(openSet, temp);
-	}
-	// etc.
-	if (x+1 < theField->width && !isInSet(closedSet, x+1, y) && !isInSet(openSet, x+1, y) && 
-	    (theField->data[x+1][y] == EMPTY || theField->data[x+1][y] == VISITED))
-	{
-		temp = initNode(x+1, y, currentNode->cost + 1, 0);
-		setHeuristic(temp, endNode);
-		insertFrontNode(openSet, temp);
-	}
-	if (y-1 >= 0 && !isInSet(closedSet, x, y-1) && !isInSet(openSet, x, y-1) && 
-	    (theField->data[x][y-1] == EMPTY || theField->data[x][y-1] == VISITED))
-	{
-		temp = initNode(x, y-1, currentNode->cost + 1, 0);
-		setHeuristic(temp, endNode);
-		insertFrontNode(openSet, temp);
-	}
-	if (y+1 < theField->height && !isInSet(closedSet, x, y+1) && !isInSet(openSet, x, y+1) && 
-	    (theField->data[x][y+1] == EMPTY || theField->data[x][y+1] == VISITED))
+	if(grid != NULL)
 	{
-		temp = initNode(x, y+1, currentNode->cost + 1, 0);
-		setHeuristic(temp, endNode);
-		insertFrontNode(openSet, temp);
+		if(*grid != NULL)
+		{
+			free((*grid)->openStamp);
+			free((*grid)->closedStamp);
+			free((*grid)->position);
+			free((*grid)->parent);
+			free((*grid)->distance);
+			free((*grid)->queue);
+			destructNodePool(&((*grid)->pool));
+			destructSearchGrid(&((*grid)->reverse));
+			free(*grid);
+			*grid = NULL;
+		}
 	}
 }
 
 /**
- * \fn node* AStar(node** openSet, node** closedSet, node* startNode, node* endNode, Field *theField)
- * \brief function which do one step of the A* algorithme
- * once the path has been found, returns the complete path. OtherWise return NULL. If no path possible, returns startNode
- * 
- * \param openSet : the chain list of nodes which represent the openSet of the A* algorithme
- * \param closedSet : the chain list of nodes which represent the closeSet of the A* algorithme
- * \param startNode : the starting node of the A* algorithme
- * \param endNode : the end node of the A* algorithme
- * \param theField* : pointer the field used to see where the path can go
- * \return node*
+ * \fn void resetSearchGrid(SearchGrid* grid)
+ * \brief function that empties the openSet and the closedSet of a grid in O(1), before a new search
+ *
+ * \param grid : the grid to reset
+ * \return void
  */
-node* AStar(node** openSet, node** closedSet, node* startNode, node* endNode, Field *theField)
+void resetSearchGrid(SearchGrid* grid)
 {
-	//If their is no nodes left in the openSet
-	if(*openSet == NULL)
+	grid->generation++;
+	//If the generation overflowed, old stamps could be mistaken for new ones so we clear them once
+	if(grid->generation == 0)
 	{
-		//We return just the starting node, which means their is no path
-		return startNode;
+		memset(grid->openStamp, 0, sizeof(uint32_t) * grid->width * grid->height);
+		memset(grid->closedStamp, 0, sizeof(uint32_t) * grid->width * grid->height);
+		grid->generation = 1;
 	}
+}
 
-	//We get the lowest heuristic node in the open set
-	node* lowestNode = getLowestNode(openSet);
-	//We remove it from the open set
-	rmvNode(openSet, lowestNode);
-	//We insert it in the closed set
-	insertFrontNode(closedSet, lowestNode);
-	//If it's in the end node coordinate
-	if (lowestNode->x == endNode->x && lowestNode->y == endNode->y)
-	{
-		//We return the reconstructed path
-		return getPath(closedSet, endNode);
-	}
-	else
+/**
+ * \fn SearchGrid* getSharedSearchGrid(int width, int height)
+ * \brief function that returns the grid shared by all the searches made on fields of the given dimension
+ * The grid is only allocated again when the dimension changes. It must only be used by one thread
+ *
+ * \param width, height : the dimension of the field on which the A* algorithme will be used
+ * \return SearchGrid*
+ */
+SearchGrid* getSharedSearchGrid(int width, int height)
+{
+	static SearchGrid* sharedGrid = NULL;
+	if(sharedGrid == NULL || sharedGrid->width != width || sharedGrid->height != height)
 	{
-		//Otherwise, we add the neighbors into the open set
-		addNeighbors(openSet, closedSet, lowestNode, endNode, theField);
-		return NULL;
+		destructSearchGrid(&sharedGrid);
+		sharedGrid = initSearchGrid(width, height);
 	}
+	return sharedGrid;
 }
 
 /**
- * \fn findPathFromStartEnd(node* startNode, node* endNode, Field *theField, bool* endEvent)
- * \brief function that finds the path between two points (start, end)
- * returns the complete path. OtherWise return NULL. If no path possible, returns startNode
- * 
- * \param startNode : the starting node of the A* algorithme
- * \param endNode : the end node of the A* algorithme
- * \param theField* : pointer to the field used to see where the path can go
- * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
- * \return node*
+ * \fn bool isOpenSearchGrid(SearchGrid* grid, int x, int y)
+ * \brief function which check if the tile at the given coordinates is in the openSet of the current search
+ *
+ * \param grid : the grid of the current search
+ * \param x, y : the coordinate to check
+ * \return bool
  */
-node* findPathFromStartEnd(node* startNode, node* endNode, Field *theField, bool* endEvent)
+bool isOpenSearchGrid(SearchGrid* grid, int x, int y)
+{
+	return grid->openStamp[y * grid->width + x] == grid->generation;
+}
+
+/**
+ * \fn bool isClosedSearchGrid(SearchGrid* grid, int x, int y)
+ * \brief function which check if the tile at the given coordinates is in the closedSet of the current search
+ *
+ * \param grid : the grid of the current search
+ * \param x, y : the coordinate to check
+ * \return bool
+ */
+bool isClosedSearchGrid(SearchGrid* grid, int x, int y)
+{
+	return grid->closedStamp[y * grid->width + x] == grid->generation;
+}
+
+/**
+ * \fn void closeSearchGrid(SearchGrid* grid, int x, int y)
+ * \brief function which add the tile at the given coordinates to the closedSet of the current search
+ *
+ * \param grid : the grid of the current search
+ * \param x, y : the coordinate of the tile
+ * \return void
+ */
+void closeSearchGrid(SearchGrid* grid, int x, int y)
+{
+	grid->closedStamp[y * grid->width + x] = grid->generation;
+}
+
+/**
+ * \fn void setSearchMode(searchModeEnum mode)
+ * \brief function that chooses the way the entities search their paths
+ *
+ * \param mode : the way the paths are searched
+ * \return void
+ */
+void setSearchMode(searchModeEnum mode)
 {
-	node* path = NULL; //Used to store a path
-	node* openSet = NULL; //Used to store the openSet for the A* algorithm
-	node* closedSet = NULL; //Used to store the closedSet for the A* algorithm
+	searchMode = mode;
+}
 
-	bool* endPathfinding = NULL; // Used to know if we need to interrupt the loop
+/**
+ * \fn searchModeEnum getSearchMode(void)
+ * \brief function that returns the way the entities search their paths
+ *
+ * \return searchModeEnum
+ */
+searchModeEnum getSearchMode(void)
+{
+	return searchMode;
+}
 
-	//If an endEvent was given as an argument
-	if (endEvent != NULL) 
+/**
+ * \fn bool setSearchModeFromName(const char* name)
+ * \brief function that chooses the way the entities search their paths from its name : "astar", "flood", "jps", "incremental", "hierarchical" or "bidirectional"
+ *
+ * \param name : the name of the way the paths are searched, can be NULL
+ * \return bool : false if the name is unknown, the way the paths are searched is then unchanged
+ */
+bool setSearchModeFromName(const char* name)
+{
+	if(name == NULL)
 	{
-		//We use it as a reference to end the loop
-		endPathfinding = endEvent;
+		return false;
 	}
-	//Otherwise
-	else
+	if(strcmp(name, "astar") == 0)
 	{
-		//We use a dummy boolean set to false
-		bool valueEndPathfinding = false;
-		endPathfinding = &valueEndPathfinding;
+		searchMode = ASTAR_SEARCH;
 	}
-	
-	//We give to the openSet a starting point
-	insertFrontNode(&openSet, cpyNode(startNode));
-	while (path == NULL && *endPathfinding == false)
+	else if(strcmp(name, "flood") == 0)
 	{
-		//We do one step of A* algorithme
-		path = AStar(&openSet, &closedSet, startNode, endNode, theField);
+		searchMode = FLOOD_SEARCH;
 	}
+	else if(strcmp(name, "jps") == 0)
+	{
+		searchMode = JPS_SEARCH;
+	}
+	else if(strcmp(name, "incremental") == 0)
+	{
+		searchMode = INCREMENTAL_SEARCH;
+	}
+	else if(strcmp(name, "hierarchical") == 0)
+	{
+		searchMode = HIERARCHICAL_SEARCH;
+	}
+	else if(strcmp(name, "bidirectional") == 0)
+	{
+		searchMode = BIDIRECTIONAL_SEARCH;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
 
-	//We free the openSet and closedSet from the memory
-	destructNodes(&openSet);
-	destructNodes(&closedSet);
-
-	//We return the path we found
-	return path;
+/**
+ * \fn void setHeuristicMode(heuristicEnum heuristic)
+ * \brief function that chooses the heuristic of the A* algorithme and of the jump point search
+ *
+ * \param heuristic : the heuristic used by distNodes
+ * \return void
+ */
+void setHeuristicMode(heuristicEnum heuristic)
+{
+	heuristicMode = heuristic;
+}
+
+/**
+ * \fn heuristicEnum getHeuristicMode(void)
+ * \brief function that returns the heuristic of the A* algorithme and of the jump point search
+ *
+ * \return heuristicEnum
+ */
+heuristicEnum getHeuristicMode(void)
+{
+	return heuristicMode;
+}
+
+/**
+ * \fn bool setHeuristicModeFromName(const char* name)
+ * \brief function that chooses the heuristic of the A* algorithme from its name : "manhattan", "octile" or "landmark"
+ *
+ * \param name : the name of the heuristic, can be NULL
+ * \return bool : false if the name is unknown, the heuristic is then unchanged
+ */
+bool setHeuristicModeFromName(const char* name)
+{
+	if(name == NULL)
+	{
+		return false;
+	}
+	if(strcmp(name, "manhattan") == 0)
+	{
+		heuristicMode = MANHATTAN_HEURISTIC;
+	}
+	else if(strcmp(name, "octile") == 0)
+	{
+		heuristicMode = OCTILE_HEURISTIC;
+	}
+	else if(strcmp(name, "landmark") == 0)
+	{
+		heuristicMode = LANDMARK_HEURISTIC;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+/**
+ * \fn void floodSearchGrid(SearchGrid* grid, node* startNode, Field *theField)
+ * \brief function that goes through all the tiles which can be reached from a starting node with a breadth first search.
+ * Afterward, a tile is reached if it is in the closedSet of the grid, the distance and the parent of each reached tile are recorded,
+ * and the shortest path to any reached tile can be read with getPathFromGrid
+ *
+ * \param grid : the grid used for the flood, it is reset by this function
+ * \param startNode : the node from which the field is flooded
+ * \param theField* : pointer to the field used to see where the path can go
+ * \return void
+ */
+void floodSearchGrid(SearchGrid* grid, node* startNode, Field *theField)
+{
+	//The neighbors are visited in the same order as addNeighbors : left, right, up, down
+	const int xOffsets[4] = {-1, 1, 0, 0};
+	const int yOffsets[4] = {0, 0, -1, 1};
+	int first = 0;
+	int last = 0;
+
+	resetSearchGrid(grid);
+	int startTile = startNode->y * grid->width + startNode->x;
+	closeSearchGrid(grid, startNode->x, startNode->y);
+	grid->parent[startTile] = -1;
+	grid->distance[startTile] = 0;
+	grid->queue[last++] = startTile;
+
+	while(first < last)
+	{
+		int currentTile = grid->queue[first++];
+		int xCurrent = currentTile % grid->width;
+		int yCurrent = currentTile / grid->width;
+
+		int direction;
+		for(direction = 0; direction < 4; direction++)
+		{
+			int x = xCurrent + xOffsets[direction];
+			int y = yCurrent + yOffsets[direction];
+			//Like addNeighbor, we only go through the empty and visited tiles
+			if(x >= 0 && x < theField->width && y >= 0 && y < theField->height &&
+			   (getFieldTile(theField, x, y) == EMPTY || getFieldTile(theField, x, y) == VISITED) &&
+			   !isClosedSearchGrid(grid, x, y))
+			{
+				int tile = y * grid->width + x;
+				closeSearchGrid(grid, x, y);
+				grid->parent[tile] = currentTile;
+				grid->distance[tile] = grid->distance[currentTile] + 1;
+				grid->queue[last++] = tile;
+			}
+		}
+	}
+}
+
+/**
+ * \fn bool isReachedSearchGrid(SearchGrid* grid, int x, int y)
+ * \brief function which check if the tile at the given coordinates has been reached by the last flood of a grid
+ *
+ * \param grid : the grid of the last flood
+ * \param x, y : the coordinate to check, which can be outside of the field
+ * \return bool
+ */
+bool isReachedSearchGrid(SearchGrid* grid, int x, int y)
+{
+	return x >= 0 && x < grid->width && y >= 0 && y < grid->height && isClosedSearchGrid(grid, x, y);
+}
+
+/**
+ * \fn NodeHeap* initNodeHeap(SearchGrid* grid)
+ * \brief function that initialise an empty heap of nodes indexed on the given grid
+ * The heap is used as the openSet of the A* algorithme
+ *
+ * \param grid : the membership grid of the search, already reset
+ * \return NodeHeap*
+ */
+NodeHeap* initNodeHeap(SearchGrid* grid)
+{
+	NodeHeap* heap = malloc(sizeof(NodeHeap));
+	heap->size = 0;
+	heap->capacity = 64;
+	heap->nbInsertion = 0;
+	heap->grid = grid;
+	heap->nodes = malloc(sizeof(node*) * heap->capacity);
+	heap->order = malloc(sizeof(int) * heap->capacity);
+	return heap;
+}
+
+/**
+ * \fn void destructNodeHeap(NodeHeap** heap)
+ * \brief function used to free a heap of nodes. The nodes it still contains belong to the pool of its grid
+ * and are not freed
+ *
+ * \param heap : a double pointer to the heap to free
+ * \return void
+ */
+void destructNodeHeap(NodeHeap** heap)
+{
+	if(heap != NULL)
+	{
+		if(*heap != NULL)
+		{
+			free((*heap)->nodes);
+			free((*heap)->order);
+			free(*heap);
+			*heap = NULL;
+		}
+	}
+}
+
+/**
+ * \fn static bool isBeforeInHeap(NodeHeap* heap, int i, int j)
+ * \brief function which check if the node at the index i of the heap must be poped before the node at the index j
+ *
+ * \param heap : the heap which contains the nodes
+ * \param i, j : the indexes of the two nodes in the heap
+ * \return bool
+ */
+static bool isBeforeInHeap(NodeHeap* heap, int i, int j)
+{
+	//The node with the lowest heuristic goes first
+	if(heap->nodes[i]->heuristic != heap->nodes[j]->heuristic)
+	{
+		return heap->nodes[i]->heuristic < heap->nodes[j]->heuristic;
+	}
+	//On equality, the last inserted goes first, as it was with the chain list
+	return heap->order[i] > heap->order[j];
+}
+
+/**
+ * \fn static void swapInHeap(NodeHeap* heap, int i, int j)
+ * \brief function which swap two nodes of the heap and update their position
+ *
+ * \param heap : the heap which contains the nodes
+ * \param i, j : the indexes of the two nodes in the heap
+ * \return void
+ */
+static void swapInHeap(NodeHeap* heap, int i, int j)
+{
+	node* tempNode = heap->nodes[i];
+	int tempOrder = heap->order[i];
+	heap->nodes[i] = heap->nodes[j];
+	heap->order[i] = heap->order[j];
+	heap->nodes[j] = tempNode;
+	heap->order[j] = tempOrder;
+
+	heap->grid->position[heap->nodes[i]->y * heap->grid->width + heap->nodes[i]->x] = i;
+	heap->grid->position[heap->nodes[j]->y * heap->grid->width + heap->nodes[j]->x] = j;
+}
+
+/**
+ * \fn static void siftUpHeap(NodeHeap* heap, int index)
+ * \brief function which move a node up in the heap until its parent goes before it
+ *
+ * \param heap : the heap which contains the node
+ * \param index : the index of the node to move
+ * \return void
+ */
+static void siftUpHeap(NodeHeap* heap, int index)
+{
+	while(index > 0 && isBeforeInHeap(heap, index, (index - 1) / 2))
+	{
+		swapInHeap(heap, index, (index - 1) / 2);
+		index = (index - 1) / 2;
+	}
+}
+
+/**
+ * \fn static void siftDownHeap(NodeHeap* heap, int index)
+ * \brief function which move a node down in the heap until it goes before its children
+ *
+ * \param heap : the heap which contains the node
+ * \param index : the index of the node to move
+ * \return void
+ */
+static void siftDownHeap(NodeHeap* heap, int index)
+{
+	bool isPlaced = false;
+	while(!isPlaced)
+	{
+		int best = index;
+		int left = 2 * index + 1;
+		int right = 2 * index + 2;
+		if(left < heap->size && isBeforeInHeap(heap, left, best))
+		{
+			best = left;
+		}
+		if(right < heap->size && isBeforeInHeap(heap, right, best))
+		{
+			best = right;
+		}
+		if(best == index)
+		{
+			isPlaced = true;
+		}
+		else
+		{
+			swapInHeap(heap, index, best);
+			index = best;
+		}
+	}
+}
+
+/**
+ * \fn void pushNodeHeap(NodeHeap* heap, node* newNode)
+ * \brief function which add a node in the heap
+ * Between two nodes with the same heuristic, the last one pushed is the first one poped (like with a chain list)
+ *
+ * \param heap : the heap in which the node is added
+ * \param newNode : the node that you want to add
+ * \return void
+ */
+void pushNodeHeap(NodeHeap* heap, node* newNode)
+{
+	if(newNode != NULL)
+	{
+		//If the heap is full, we double its capacity
+		if(heap->size == heap->capacity)
+		{
+			heap->capacity *= 2;
+			heap->nodes = realloc(heap->nodes, sizeof(node*) * heap->capacity);
+			heap->order = realloc(heap->order, sizeof(int) * heap->capacity);
+		}
+		//We add the node at the bottom of the heap
+		heap->nodes[heap->size] = newNode;
+		heap->order[heap->size] = heap->nbInsertion;
+		heap->grid->position[newNode->y * heap->grid->width + newNode->x] = heap->size;
+		heap->grid->openStamp[newNode->y * heap->grid->width + newNode->x] = heap->grid->generation;
+		heap->size++;
+		heap->nbInsertion++;
+		//Then we move it up to its place
+		siftUpHeap(heap, heap->size - 1);
+	}
+}
+
+/**
+ * \fn node* popNodeHeap(NodeHeap* heap)
+ * \brief function which pop the node with the best heuristic (the lowest) out of the heap and returns it
+ *
+ * \param heap : the heap from which the node is poped
+ * \return node* : the poped node, NULL if the heap is empty
+ */
+node* popNodeHeap(NodeHeap* heap)
+{
+	node* popedNode = NULL;
+	if(heap->size > 0)
+	{
+		//The best node is always at the top of the heap
+		popedNode = heap->nodes[0];
+		//We replace it by the last node of the heap and move it down to its place
+		swapInHeap(heap, 0, heap->size - 1);
+		heap->size--;
+		siftDownHeap(heap, 0);
+		//The tile of the poped node is not in the openSet anymore
+		heap->grid->openStamp[popedNode->y * heap->grid->width + popedNode->x] = 0;
+	}
+	return popedNode;
+}
+
+/**
+ * \fn node* getNodeHeap(NodeHeap* heap, int x, int y)
+ * \brief function which returns the node of the heap at the given coordinates
+ *
+ * \param heap : the heap in which we search the node
+ * \param x, y : the coordinate to check
+ * \return node* : the node found, NULL if their is none
+ */
+node* getNodeHeap(NodeHeap* heap, int x, int y)
+{
+	if(!isOpenSearchGrid(heap->grid, x, y))
+	{
+		return NULL;
+	}
+	return heap->nodes[heap->grid->position[y * heap->grid->width + x]];
+}
+
+/**
+ * \fn void decreaseNodeHeap(NodeHeap* heap, node* nodeToUpdate, int cost, node* endNode)
+ * \brief function which lower the cost of a node of the heap and move it up to its new place (decrease-key)
+ *
+ * \param heap : the heap which contains the node
+ * \param nodeToUpdate : the node to update, must be in the heap
+ * \param cost : the new cost of the node, must be lower than the actual one
+ * \param endNode : the end node of the A* algorithme, used to set the new heuristic
+ * \return void
+ */
+void decreaseNodeHeap(NodeHeap* heap, node* nodeToUpdate, int cost, node* endNode)
+{
+	nodeToUpdate->cost = cost;
+	setHeuristic(nodeToUpdate, endNode);
+	//A lower heuristic can only move the node up in the heap
+	siftUpHeap(heap, heap->grid->position[nodeToUpdate->y * heap->grid->width + nodeToUpdate->x]);
+}
+
+/**
+ * \fn void addNeighbor(NodeHeap* openSet, node* currentNode, node* endNode, Field *theField, int x, int y)
+ * \brief function which adds or updates one neighbor of a given node in the openSet of the A* algorithme
+ * A neighbor already in the openSet is only updated if it is reached with a lower cost
+ * 
+ * \param openSet : the heap of nodes which represent the openSet of the A* algorithme
+ * \param currentNode : the reference node used to create the neighbor
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : poiter to the field used to see if it is a valid neighbor or not
+ * \param x, y : the coordinate of the neighbor
+ * \return void
+ */
+void addNeighbor(NodeHeap* openSet, node* currentNode, node* endNode, Field *theField, int x, int y)
+{
+	/*We check if the neighbor :
+	-Is inside of the field
+	-Is in an empty tile
+	-Is not in the closed set
+	*/
+	if(x >= 0 && x < theField->width && y >= 0 && y < theField->height &&
+	   (getFieldTile(theField, x, y) == EMPTY || getFieldTile(theField, x, y) == VISITED) &&
+	   !isClosedSearchGrid(openSet->grid, x, y))
+	{
+		node* openNode = getNodeHeap(openSet, x, y);
+		int currentTile = currentNode->y * theField->width + currentNode->x;
+		//If it is not in the open set yet
+		if(openNode == NULL)
+		{
+			//We create it
+			node* temp = allocNodePool(openSet->grid->pool, x, y, currentNode->cost + 1, 0);
+			//We set his heuristic
+			setHeuristic(temp, endNode);
+			//We insert it in the openSet
+			pushNodeHeap(openSet, temp);
+			//We remember from which tile we reached it
+			openSet->grid->parent[y * theField->width + x] = currentTile;
+		}
+		//If we found a shorter way to reach it
+		else if(currentNode->cost + 1 < openNode->cost)
+		{
+			//We update its cost and its place in the openSet
+			decreaseNodeHeap(openSet, openNode, currentNode->cost + 1, endNode);
+			openSet->grid->parent[y * theField->width + x] = currentTile;
+		}
+	}
+}
+
+/**
+ * \fn void addNeighbors(NodeHeap* openSet, node* currentNode, node* endNode, Field *theField)
+ * \brief function which adds and create the neighboors of a given node in the openSet of the A* algorithme
+ * It adds neighbors only if they are not in the closedSet, and updates the ones already in the openSet
+ * The closedSet is read from the grid of the openSet
+ * 
+ * \param openSet : the heap of nodes which represent the openSet of the A* algorithme
+ * \param currentNode : the reference node used to create the neighbors
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : poiter to the field used to see if it is a valid neighbor or not
+ * \return void
+ */
+void addNeighbors(NodeHeap* openSet, node* currentNode, node* endNode, Field *theField)
+{
+	int x = currentNode->x;
+	int y = currentNode->y;
+
+	//The neighbors are added in the same order as before : left, right, up and down
+	addNeighbor(openSet, currentNode, endNode, theField, x-1, y);
+	addNeighbor(openSet, currentNode, endNode, theField, x+1, y);
+	addNeighbor(openSet, currentNode, endNode, theField, x, y-1);
+	addNeighbor(openSet, currentNode, endNode, theField, x, y+1);
+}
+
+/**
+ * \fn pathStatusEnum stepAStar(NodeHeap* openSet, node* endNode, Field *theField)
+ * \brief function which do one step of the A* algorithme without building the path
+ * 
+ * \param openSet : the heap of nodes which represent the openSet of the A* algorithme, whose grid also keeps the closedSet
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer the field used to see where the path can go
+ * \return pathStatusEnum : PATH_FOUND once the end node is reached, PATH_NOT_FOUND if no path is possible
+ */
+pathStatusEnum stepAStar(NodeHeap* openSet, node* endNode, Field *theField)
+{
+	//If their is no nodes left in the openSet, their is no path
+	if(openSet->size == 0)
+	{
+		return PATH_NOT_FOUND;
+	}
+
+	//We pop the lowest heuristic node out of the open set
+	node* lowestNode = popNodeHeap(openSet);
+	//We insert it in the closed set
+	closeSearchGrid(openSet->grid, lowestNode->x, lowestNode->y);
+	//If it's in the end node coordinate
+	if (lowestNode->x == endNode->x && lowestNode->y == endNode->y)
+	{
+		return PATH_FOUND;
+	}
+	//Otherwise, we add the neighbors into the open set
+	addNeighbors(openSet, lowestNode, endNode, theField);
+	return PATH_SEARCHING;
+}
+
+/**
+ * \fn node* AStar(NodeHeap* openSet, node* startNode, node* endNode, Field *theField)
+ * \brief function which do one step of the A* algorithme
+ * once the path has been found, returns the complete path. OtherWise return NULL. If no path possible, returns startNode
+ * 
+ * \param openSet : the heap of nodes which represent the openSet of the A* algorithme, whose grid also keeps the closedSet
+ * \param startNode : the starting node of the A* algorithme
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer the field used to see where the path can go
+ * \return node*
+ */
+node* AStar(NodeHeap* openSet, node* startNode, node* endNode, Field *theField)
+{
+	pathStatusEnum status = stepAStar(openSet, endNode, theField);
+	if(status == PATH_NOT_FOUND)
+	{
+		//We return just the starting node, which means their is no path
+		return startNode;
+	}
+	if(status == PATH_FOUND)
+	{
+		//We return the reconstructed path
+		return getPathFromGrid(openSet->grid, endNode);
+	}
+	return NULL;
+}
+
+/**
+ * \fn bool isWalkableTile(const Field *theField, int x, int y)
+ * \brief function which check if a path can go through the tile at the given coordinates, like addNeighbor does
+ *
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param x, y : the coordinate to check, which can be outside of the field
+ * \return bool
+ */
+bool isWalkableTile(const Field *theField, int x, int y)
+{
+	return x >= 0 && x < theField->width && y >= 0 && y < theField->height &&
+	       (getFieldTile(theField, x, y) == EMPTY || getFieldTile(theField, x, y) == VISITED);
+}
+
+/**
+ * \fn static bool jumpHorizontal(Field *theField, node* endNode, int* x, int y, int dx)
+ * \brief function which moves along a row from a tile until it finds a jump point : the end node, or a tile
+ * from which the path can go up or down while it could not from the previous tile
+ *
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endNode : the end node of the search
+ * \param x : pointer to the column of the starting tile, set to the column of the jump point found
+ * \param y : the row of the starting tile
+ * \param dx : the direction of the move, -1 or 1
+ * \return bool : false if a wall or the border of the field is reached first
+ */
+static bool jumpHorizontal(Field *theField, node* endNode, int* x, int y, int dx)
+{
+	int xCurrent = *x + dx;
+	while(isWalkableTile(theField, xCurrent, y))
+	{
+		if((xCurrent == endNode->x && y == endNode->y) ||
+		   (isWalkableTile(theField, xCurrent, y - 1) && !isWalkableTile(theField, xCurrent - dx, y - 1)) ||
+		   (isWalkableTile(theField, xCurrent, y + 1) && !isWalkableTile(theField, xCurrent - dx, y + 1)))
+		{
+			*x = xCurrent;
+			return true;
+		}
+		xCurrent += dx;
+	}
+	return false;
+}
+
+/**
+ * \fn static bool jumpVertical(Field *theField, node* endNode, int x, int* y, int dy)
+ * \brief function which moves along a column from a tile until it finds a jump point : the end node, or a tile
+ * from which a horizontal move finds a jump point
+ *
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endNode : the end node of the search
+ * \param x : the column of the starting tile
+ * \param y : pointer to the row of the starting tile, set to the row of the jump point found
+ * \param dy : the direction of the move, -1 or 1
+ * \return bool : false if a wall or the border of the field is reached first
+ */
+static bool jumpVertical(Field *theField, node* endNode, int x, int* y, int dy)
+{
+	int yCurrent = *y + dy;
+	while(isWalkableTile(theField, x, yCurrent))
+	{
+		int xLeft = x;
+		int xRight = x;
+		if((x == endNode->x && yCurrent == endNode->y) ||
+		   jumpHorizontal(theField, endNode, &xLeft, yCurrent, -1) ||
+		   jumpHorizontal(theField, endNode, &xRight, yCurrent, 1))
+		{
+			*y = yCurrent;
+			return true;
+		}
+		yCurrent += dy;
+	}
+	return false;
+}
+
+/**
+ * \fn static void addJumpPoint(NodeHeap* openSet, node* currentNode, node* endNode, int x, int y)
+ * \brief function which adds or updates a jump point in the openSet of the jump point search
+ * Its heuristic is its cost plus its distance to the end node estimated by distNodes, so the path found is a shortest path
+ *
+ * \param openSet : the heap of nodes which represent the openSet of the search
+ * \param currentNode : the jump point from which the new one has been found, in the same row or column
+ * \param endNode : the end node of the search
+ * \param x, y : the coordinate of the jump point
+ * \return void
+ */
+static void addJumpPoint(NodeHeap* openSet, node* currentNode, node* endNode, int x, int y)
+{
+	SearchGrid* grid = openSet->grid;
+	if(!isClosedSearchGrid(grid, x, y))
+	{
+		int cost = currentNode->cost + abs(x - currentNode->x) + abs(y - currentNode->y);
+		int heuristic = cost + estimateDistance(x, y, endNode->x, endNode->y);
+		node* openNode = getNodeHeap(openSet, x, y);
+		//If it is not in the open set yet
+		if(openNode == NULL)
+		{
+			pushNodeHeap(openSet, allocNodePool(grid->pool, x, y, cost, heuristic));
+			grid->parent[y * grid->width + x] = currentNode->y * grid->width + currentNode->x;
+		}
+		//If we found a shorter way to reach it
+		else if(cost < openNode->cost)
+		{
+			openNode->cost = cost;
+			openNode->heuristic = heuristic;
+			siftUpHeap(openSet, grid->position[y * grid->width + x]);
+			grid->parent[y * grid->width + x] = currentNode->y * grid->width + currentNode->x;
+		}
+	}
+}
+
+/**
+ * \fn static void fillJumpParents(SearchGrid* grid, node* endNode)
+ * \brief function which sets the parents of the tiles between the jump points of the path found by a jump point search,
+ * so the path can be read tile by tile with getPathFromGrid
+ *
+ * \param grid : the grid of the search which reached the end node
+ * \param endNode : the end node of the search
+ * \return void
+ */
+static void fillJumpParents(SearchGrid* grid, node* endNode)
+{
+	int tile = endNode->y * grid->width + endNode->x;
+	while(grid->parent[tile] != -1)
+	{
+		int jumpPoint = grid->parent[tile];
+		//Two following jump points are always in the same row or in the same column
+		int step = 1;
+		if(jumpPoint / grid->width != tile / grid->width)
+		{
+			step = grid->width;
+		}
+		if(jumpPoint < tile)
+		{
+			step = -step;
+		}
+		while(tile != jumpPoint)
+		{
+			grid->parent[tile] = tile + step;
+			tile += step;
+		}
+	}
+}
+
+/**
+ * \fn static pathStatusEnum searchJumpPoints(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+ * \brief function that runs a jump point search until the end node is reached, no path is possible or the search is interrupted
+ * Instead of adding the neighbors of each tile, the search moves in straight lines from each jump point to the next ones,
+ * so the open areas are crossed without adding their tiles. The path can then be read from the parents of the grid
+ *
+ * \param startNode : the starting node of the search
+ * \param endNode : the end node of the search
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \param grid : the grid used for the search, it is reset by this function
+ * \return pathStatusEnum : PATH_SEARCHING if the search was interrupted
+ */
+static pathStatusEnum searchJumpPoints(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+{
+	pathStatusEnum status = PATH_SEARCHING;
+	NodeHeap* openSet = NULL; //Used to store the jump points to visit
+
+	//We empty the sets of the previous search
+	resetSearchGrid(grid);
+	openSet = initNodeHeap(grid);
+	//We give to the openSet a starting point, which has no parent
+	pushNodeHeap(openSet, allocNodePool(grid->pool, startNode->x, startNode->y, 0, estimateDistance(startNode->x, startNode->y, endNode->x, endNode->y)));
+	grid->parent[startNode->y * grid->width + startNode->x] = -1;
+	while (status == PATH_SEARCHING && (endEvent == NULL || *endEvent == false))
+	{
+		//If their is no jump points left in the openSet, their is no path
+		if(openSet->size == 0)
+		{
+			status = PATH_NOT_FOUND;
+		}
+		else
+		{
+			node* currentNode = popNodeHeap(openSet);
+			closeSearchGrid(grid, currentNode->x, currentNode->y);
+			if(currentNode->x == endNode->x && currentNode->y == endNode->y)
+			{
+				fillJumpParents(grid, endNode);
+				status = PATH_FOUND;
+			}
+			else
+			{
+				//We look for the next jump points in the four directions : left, right, up and down
+				int x = currentNode->x;
+				int y = currentNode->y;
+				if(jumpHorizontal(theField, endNode, &x, currentNode->y, -1))
+				{
+					addJumpPoint(openSet, currentNode, endNode, x, currentNode->y);
+				}
+				x = currentNode->x;
+				if(jumpHorizontal(theField, endNode, &x, currentNode->y, 1))
+				{
+					addJumpPoint(openSet, currentNode, endNode, x, currentNode->y);
+				}
+				if(jumpVertical(theField, endNode, currentNode->x, &y, -1))
+				{
+					addJumpPoint(openSet, currentNode, endNode, currentNode->x, y);
+				}
+				y = currentNode->y;
+				if(jumpVertical(theField, endNode, currentNode->x, &y, 1))
+				{
+					addJumpPoint(openSet, currentNode, endNode, currentNode->x, y);
+				}
+			}
+		}
+	}
+
+	//We free the openSet, and give back all the nodes to the pool at once
+	destructNodeHeap(&openSet);
+	resetNodePool(grid->pool);
+
+	return status;
+}
+
+/**
+ * \fn static int getCostSearchGrid(SearchGrid* grid, NodeHeap* openSet, int x, int y)
+ * \brief function which returns the cost with which a search reached a tile, from its closedSet or its openSet
+ *
+ * \param grid : the grid of the search, in which the closed tiles have their cost as distance
+ * \param openSet : the openSet of the search
+ * \param x, y : the coordinate of the tile
+ * \return int : the cost, INFINITE_DISTANCE if the search has not reached the tile
+ */
+static int getCostSearchGrid(SearchGrid* grid, NodeHeap* openSet, int x, int y)
+{
+	if(isClosedSearchGrid(grid, x, y))
+	{
+		return grid->distance[y * grid->width + x];
+	}
+	if(isOpenSearchGrid(grid, x, y))
+	{
+		return getNodeHeap(openSet, x, y)->cost;
+	}
+	return INFINITE_DISTANCE;
+}
+
+/**
+ * \fn static pathStatusEnum searchBidirectional(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+ * \brief function that runs an A* search from the start node and another one from the end node, one step at a time
+ * on the side which has the smallest openSet, and keeps the cheapest path found where they meet.
+ * The searches stop once the lowest heuristic of one of the openSets is not below the cost of this path,
+ * so it is a shortest path. The path can then be read from the parents of the grid
+ * 
+ * \param startNode : the starting node of the search
+ * \param endNode : the end node of the search
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \param grid : the grid used for the search from the start node, it is reset by this function
+ * \return pathStatusEnum : PATH_SEARCHING if the search was interrupted
+ */
+static pathStatusEnum searchBidirectional(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+{
+	pathStatusEnum status = PATH_SEARCHING;
+	//The neighbor offsets, with first the tile itself : left, right, up and down
+	const int xOffsets[5] = {0, -1, 1, 0, 0};
+	const int yOffsets[5] = {0, 0, 0, -1, 1};
+	int bestCost = INFINITE_DISTANCE; //The cost of the cheapest path found where the searches met
+	int forwardTile = -1; //The last tile of this path reached by the search from the start node
+	int backwardTile = -1; //The first tile of this path reached by the search from the end node
+
+	//Like with the A* search, a path can only go to the end node through an empty or visited tile
+	if(!(startNode->x == endNode->x && startNode->y == endNode->y) && !isWalkableTile(theField, endNode->x, endNode->y))
+	{
+		return PATH_NOT_FOUND;
+	}
+	if(grid->reverse == NULL)
+	{
+		grid->reverse = initSearchGrid(grid->width, grid->height);
+	}
+	SearchGrid* reverse = grid->reverse;
+	//We empty the sets of the previous search
+	resetSearchGrid(grid);
+	resetSearchGrid(reverse);
+	NodeHeap* forwardSet = initNodeHeap(grid);
+	NodeHeap* backwardSet = initNodeHeap(reverse);
+	//Each search starts from one end of the path, which has no parent
+	pushNodeHeap(forwardSet, allocNodePool(grid->pool, startNode->x, startNode->y, 0, distNodes(endNode, startNode)));
+	grid->parent[startNode->y * grid->width + startNode->x] = -1;
+	pushNodeHeap(backwardSet, allocNodePool(reverse->pool, endNode->x, endNode->y, 0, distNodes(startNode, endNode)));
+	reverse->parent[endNode->y * reverse->width + endNode->x] = -1;
+
+	while (status == PATH_SEARCHING && (endEvent == NULL || *endEvent == false))
+	{
+		if(bestCost != INFINITE_DISTANCE &&
+		   (forwardSet->size == 0 || backwardSet->size == 0 ||
+		    forwardSet->nodes[0]->heuristic >= bestCost || backwardSet->nodes[0]->heuristic >= bestCost))
+		{
+			//No node left in one of the openSets can be on a cheaper path
+			status = PATH_FOUND;
+		}
+		else if(forwardSet->size == 0 || backwardSet->size == 0)
+		{
+			//One of the searches went through all the tiles it can reach without meeting the other one
+			status = PATH_NOT_FOUND;
+		}
+		else
+		{
+			//We go on with the search which has the smallest openSet
+			NodeHeap* openSet = forwardSet;
+			NodeHeap* otherSet = backwardSet;
+			if(backwardSet->size < forwardSet->size)
+			{
+				openSet = backwardSet;
+				otherSet = forwardSet;
+			}
+			node* lowestNode = popNodeHeap(openSet);
+			int tile = lowestNode->y * grid->width + lowestNode->x;
+			closeSearchGrid(openSet->grid, lowestNode->x, lowestNode->y);
+			openSet->grid->distance[tile] = lowestNode->cost;
+			//If the other search reached this tile or one of its neighbors, the two parts make a path
+			int direction;
+			for(direction = 0; direction < 5; direction++)
+			{
+				int x = lowestNode->x + xOffsets[direction];
+				int y = lowestNode->y + yOffsets[direction];
+				int otherCost = INFINITE_DISTANCE;
+				if(x >= 0 && x < grid->width && y >= 0 && y < grid->height)
+				{
+					otherCost = getCostSearchGrid(otherSet->grid, otherSet, x, y);
+				}
+				//The step between the two tiles can be made, as the tile reached from the end node is empty, visited or the end node
+				int cost = lowestNode->cost + abs(xOffsets[direction]) + abs(yOffsets[direction]);
+				if(otherCost != INFINITE_DISTANCE && cost + otherCost < bestCost)
+				{
+					bestCost = cost + otherCost;
+					forwardTile = tile;
+					backwardTile = y * grid->width + x;
+					if(openSet == backwardSet)
+					{
+						forwardTile = y * grid->width + x;
+						backwardTile = tile;
+					}
+				}
+			}
+			if(openSet == forwardSet)
+			{
+				addNeighbors(openSet, lowestNode, endNode, theField);
+			}
+			else
+			{
+				//The search from the end node adds the neighbors in the reverse order (down, up, right and left),
+				//so between nodes with the same heuristic both searches follow the same path and meet in its middle
+				addNeighbor(openSet, lowestNode, startNode, theField, lowestNode->x, lowestNode->y+1);
+				addNeighbor(openSet, lowestNode, startNode, theField, lowestNode->x, lowestNode->y-1);
+				addNeighbor(openSet, lowestNode, startNode, theField, lowestNode->x+1, lowestNode->y);
+				addNeighbor(openSet, lowestNode, startNode, theField, lowestNode->x-1, lowestNode->y);
+			}
+		}
+	}
+
+	if(status == PATH_FOUND)
+	{
+		//We reverse the parents of the search from the end node, so the whole path can be read from the grid
+		int previousTile = forwardTile;
+		int tile = backwardTile;
+		if(tile == previousTile)
+		{
+			tile = reverse->parent[tile];
+		}
+		while(tile != -1)
+		{
+			int nextTile = reverse->parent[tile];
+			grid->parent[tile] = previousTile;
+			previousTile = tile;
+			tile = nextTile;
+		}
+	}
+
+	//We free the openSets, and give back all the nodes of both searches to their pools at once
+	destructNodeHeap(&forwardSet);
+	destructNodeHeap(&backwardSet);
+	resetNodePool(grid->pool);
+	resetNodePool(reverse->pool);
+
+	return status;
+}
+
+/**
+ * \fn IncrementalPlanner* initIncrementalPlanner(int width, int height)
+ * \brief function that initialise an incremental planner without goal for the fields of the given dimension
+ *
+ * \param width, height : the dimension of the fields on which the planner will be used
+ * \return IncrementalPlanner*
+ */
+IncrementalPlanner* initIncrementalPlanner(int width, int height)
+{
+	IncrementalPlanner* planner = malloc(sizeof(IncrementalPlanner));
+	planner->width = width;
+	planner->height = height;
+	planner->xGoal = -1;
+	planner->yGoal = -1;
+	planner->map = NULL;
+	planner->walkable = malloc(sizeof(bool) * width * height);
+	planner->distance = malloc(sizeof(int) * width * height);
+	planner->lookahead = malloc(sizeof(int) * width * height);
+	planner->queue = malloc(sizeof(int) * width * height);
+	planner->queuePosition = malloc(sizeof(int) * width * height);
+	planner->queueSize = 0;
+	return planner;
+}
+
+/**
+ * \fn void destructIncrementalPlanner(IncrementalPlanner** planner)
+ * \brief function used to free an incremental planner
+ *
+ * \param planner : a double pointer to the planner to free
+ * \return void
+ */
+void destructIncrementalPlanner(IncrementalPlanner** planner)
+{
+	if(planner != NULL)
+	{
+		if(*planner != NULL)
+		{
+			free((*planner)->walkable);
+			free((*planner)->distance);
+			free((*planner)->lookahead);
+			free((*planner)->queue);
+			free((*planner)->queuePosition);
+			free(*planner);
+			*planner = NULL;
+		}
+	}
+}
+
+/**
+ * \fn static int getKeyIncrementalPlanner(IncrementalPlanner* planner, int tile)
+ * \brief function which returns the key of a tile in the queue of an incremental planner : the lowest of its distance and lookahead
+ *
+ * \param planner : the incremental planner
+ * \param tile : the index of the tile
+ * \return int
+ */
+static int getKeyIncrementalPlanner(IncrementalPlanner* planner, int tile)
+{
+	if(planner->distance[tile] < planner->lookahead[tile])
+	{
+		return planner->distance[tile];
+	}
+	return planner->lookahead[tile];
+}
+
+/**
+ * \fn static bool isBeforeInPlanner(IncrementalPlanner* planner, int i, int j)
+ * \brief function which check if the tile at the index i of the queue of a planner must be poped before the tile at the index j
+ *
+ * \param planner : the incremental planner
+ * \param i, j : the indexes of the two tiles in the queue
+ * \return bool
+ */
+static bool isBeforeInPlanner(IncrementalPlanner* planner, int i, int j)
+{
+	int keyI = getKeyIncrementalPlanner(planner, planner->queue[i]);
+	int keyJ = getKeyIncrementalPlanner(planner, planner->queue[j]);
+	if(keyI != keyJ)
+	{
+		return keyI < keyJ;
+	}
+	//On equality, the tile with the lowest index goes first, so the repairs don't depend on the order of the changes
+	return planner->queue[i] < planner->queue[j];
+}
+
+/**
+ * \fn static void swapInPlanner(IncrementalPlanner* planner, int i, int j)
+ * \brief function which swap two tiles of the queue of a planner and update their position
+ *
+ * \param planner : the incremental planner
+ * \param i, j : the indexes of the two tiles in the queue
+ * \return void
+ */
+static void swapInPlanner(IncrementalPlanner* planner, int i, int j)
+{
+	int temp = planner->queue[i];
+	planner->queue[i] = planner->queue[j];
+	planner->queue[j] = temp;
+	planner->queuePosition[planner->queue[i]] = i;
+	planner->queuePosition[planner->queue[j]] = j;
+}
+
+/**
+ * \fn static void siftPlanner(IncrementalPlanner* planner, int index)
+ * \brief function which move a tile of the queue of a planner up or down to its place
+ *
+ * \param planner : the incremental planner
+ * \param index : the index of the tile to move
+ * \return void
+ */
+static void siftPlanner(IncrementalPlanner* planner, int index)
+{
+	while(index > 0 && isBeforeInPlanner(planner, index, (index - 1) / 2))
+	{
+		swapInPlanner(planner, index, (index - 1) / 2);
+		index = (index - 1) / 2;
+	}
+	bool isPlaced = false;
+	while(!isPlaced)
+	{
+		int best = index;
+		int left = 2 * index + 1;
+		int right = 2 * index + 2;
+		if(left < planner->queueSize && isBeforeInPlanner(planner, left, best))
+		{
+			best = left;
+		}
+		if(right < planner->queueSize && isBeforeInPlanner(planner, right, best))
+		{
+			best = right;
+		}
+		if(best == index)
+		{
+			isPlaced = true;
+		}
+		else
+		{
+			swapInPlanner(planner, index, best);
+			index = best;
+		}
+	}
+}
+
+/**
+ * \fn static void removeFromPlanner(IncrementalPlanner* planner, int tile)
+ * \brief function which removes a tile from the queue of a planner, if it is in it
+ *
+ * \param planner : the incremental planner
+ * \param tile : the index of the tile
+ * \return void
+ */
+static void removeFromPlanner(IncrementalPlanner* planner, int tile)
+{
+	int index = planner->queuePosition[tile];
+	if(index != -1)
+	{
+		planner->queueSize--;
+		planner->queuePosition[tile] = -1;
+		if(index != planner->queueSize)
+		{
+			planner->queue[index] = planner->queue[planner->queueSize];
+			planner->queuePosition[planner->queue[index]] = index;
+			siftPlanner(planner, index);
+		}
+	}
+}
+
+/**
+ * \fn static void updateVertexPlanner(IncrementalPlanner* planner, int x, int y)
+ * \brief function which computes the lookahead of a tile from its neighbors, and puts the tile in the queue
+ * of the planner if its distance needs to be repaired
+ *
+ * \param planner : the incremental planner
+ * \param x, y : the coordinate of the tile, which can be outside of the field
+ * \return void
+ */
+static void updateVertexPlanner(IncrementalPlanner* planner, int x, int y)
+{
+	if(x >= 0 && x < planner->width && y >= 0 && y < planner->height)
+	{
+		int tile = y * planner->width + x;
+		int lookahead = INFINITE_DISTANCE;
+		if(planner->walkable[tile])
+		{
+			if(x == planner->xGoal && y == planner->yGoal)
+			{
+				lookahead = 0;
+			}
+			else
+			{
+				//The lookahead is one more than the distance of the closest neighbor
+				if(x > 0 && planner->distance[tile - 1] < lookahead)
+				{
+					lookahead = planner->distance[tile - 1];
+				}
+				if(x < planner->width - 1 && planner->distance[tile + 1] < lookahead)
+				{
+					lookahead = planner->distance[tile + 1];
+				}
+				if(y > 0 && planner->distance[tile - planner->width] < lookahead)
+				{
+					lookahead = planner->distance[tile - planner->width];
+				}
+				if(y < planner->height - 1 && planner->distance[tile + planner->width] < lookahead)
+				{
+					lookahead = planner->distance[tile + planner->width];
+				}
+				if(lookahead != INFINITE_DISTANCE)
+				{
+					lookahead++;
+				}
+			}
+		}
+		planner->lookahead[tile] = lookahead;
+
+		removeFromPlanner(planner, tile);
+		if(planner->distance[tile] != planner->lookahead[tile])
+		{
+			planner->queue[planner->queueSize] = tile;
+			planner->queuePosition[tile] = planner->queueSize;
+			planner->queueSize++;
+			siftPlanner(planner, planner->queueSize - 1);
+		}
+	}
+}
+
+/**
+ * \fn static void computeIncrementalPlanner(IncrementalPlanner* planner)
+ * \brief function which repairs the distances of all the tiles in the queue of a planner, and of the tiles they change
+ *
+ * \param planner : the incremental planner
+ * \return void
+ */
+static void computeIncrementalPlanner(IncrementalPlanner* planner)
+{
+	while(planner->queueSize > 0)
+	{
+		int tile = planner->queue[0];
+		int x = tile % planner->width;
+		int y = tile / planner->width;
+		removeFromPlanner(planner, tile);
+		if(planner->distance[tile] > planner->lookahead[tile])
+		{
+			//The tile got closer to the goal
+			planner->distance[tile] = planner->lookahead[tile];
+		}
+		else
+		{
+			//The tile got further from the goal, we compute it again from its neighbors
+			planner->distance[tile] = INFINITE_DISTANCE;
+			updateVertexPlanner(planner, x, y);
+		}
+		updateVertexPlanner(planner, x - 1, y);
+		updateVertexPlanner(planner, x + 1, y);
+		updateVertexPlanner(planner, x, y - 1);
+		updateVertexPlanner(planner, x, y + 1);
+	}
+}
+
+/**
+ * \fn void setGoalIncrementalPlanner(IncrementalPlanner* planner, const Field* map, int xGoal, int yGoal)
+ * \brief function that sets the goal of an incremental planner. If the goal or the field changed,
+ * all the distances are forgotten, otherwise they are kept
+ *
+ * \param planner : the incremental planner
+ * \param map : the field on which the distances are computed, of the dimension of the planner
+ * \param xGoal, yGoal : the coordinate of the goal
+ * \return void
+ */
+void setGoalIncrementalPlanner(IncrementalPlanner* planner, const Field* map, int xGoal, int yGoal)
+{
+	if(planner->map != map || planner->xGoal != xGoal || planner->yGoal != yGoal)
+	{
+		planner->map = map;
+		planner->xGoal = xGoal;
+		planner->yGoal = yGoal;
+		planner->queueSize = 0;
+		int x, y;
+		for(y = 0; y < planner->height; y++)
+		{
+			for(x = 0; x < planner->width; x++)
+			{
+				int tile = y * planner->width + x;
+				planner->walkable[tile] = isWalkableTile(map, x, y);
+				planner->distance[tile] = INFINITE_DISTANCE;
+				planner->lookahead[tile] = INFINITE_DISTANCE;
+				planner->queuePosition[tile] = -1;
+			}
+		}
+		//Only the goal is known at first, the other distances are computed from it
+		updateVertexPlanner(planner, xGoal, yGoal);
+	}
+}
+
+/**
+ * \fn void updateTileIncrementalPlanner(IncrementalPlanner* planner, int x, int y)
+ * \brief function that tells an incremental planner that a tile of its field has changed
+ * The distances are repaired the next time a path is asked
+ *
+ * \param planner : the incremental planner
+ * \param x, y : the coordinate of the tile which changed
+ * \return void
+ */
+void updateTileIncrementalPlanner(IncrementalPlanner* planner, int x, int y)
+{
+	if(planner != NULL && planner->map != NULL)
+	{
+		int tile = y * planner->width + x;
+		bool walkable = isWalkableTile(planner->map, x, y);
+		//Only the tiles through which a path can go, or not go anymore, change the distances
+		if(walkable != planner->walkable[tile])
+		{
+			planner->walkable[tile] = walkable;
+			updateVertexPlanner(planner, x, y);
+		}
+	}
+}
+
+/**
+ * \fn node* findPathFromIncrementalPlanner(IncrementalPlanner* planner, node* startNode)
+ * \brief function that repairs the distances of an incremental planner and returns a shortest path from a starting node to its goal
+ *
+ * \param planner : the incremental planner, with a goal
+ * \param startNode : the starting node of the path
+ * \return node* : the path, startNode if the goal can't be reached
+ */
+node* findPathFromIncrementalPlanner(IncrementalPlanner* planner, node* startNode)
+{
+	computeIncrementalPlanner(planner);
+
+	int tile = startNode->y * planner->width + startNode->x;
+	if(planner->distance[tile] == INFINITE_DISTANCE)
+	{
+		//We return just the starting node, which means their is no path
+		return startNode;
+	}
+	//We go down the distances from the start to the goal
+	node* path = initNode(startNode->x, startNode->y, 0, planner->distance[tile]);
+	node* lastNode = path;
+	while(planner->distance[tile] > 0)
+	{
+		int x = tile % planner->width;
+		int y = tile / planner->width;
+		int next = tile;
+		//The neighbors are tried in the same order as addNeighbors : left, right, up and down
+		if(x > 0 && planner->distance[tile - 1] < planner->distance[next])
+		{
+			next = tile - 1;
+		}
+		if(x < planner->width - 1 && planner->distance[tile + 1] < planner->distance[next])
+		{
+			next = tile + 1;
+		}
+		if(y > 0 && planner->distance[tile - planner->width] < planner->distance[next])
+		{
+			next = tile - planner->width;
+		}
+		if(y < planner->height - 1 && planner->distance[tile + planner->width] < planner->distance[next])
+		{
+			next = tile + planner->width;
+		}
+		tile = next;
+		lastNode->linkedNode = initNode(tile % planner->width, tile / planner->width, lastNode->cost + 1, planner->distance[tile]);
+		lastNode = lastNode->linkedNode;
+	}
+	return path;
+}
+
+/**
+ * \fn Landmarks* initLandmarks(int width, int height)
+ * \brief function that initialise the landmarks of the fields of the given dimension, without any field
+ *
+ * \param width, height : the dimension of the fields
+ * \return Landmarks*
+ */
+Landmarks* initLandmarks(int width, int height)
+{
+	Landmarks* landmarks = malloc(sizeof(Landmarks));
+	landmarks->width = width;
+	landmarks->height = height;
+	landmarks->map = NULL;
+	landmarks->isValid = false;
+	landmarks->nbLandmarks = 0;
+	landmarks->blocked = malloc(sizeof(bool) * width * height);
+	landmarks->distance = malloc(sizeof(int) * width * height * NB_LANDMARKS);
+	landmarks->queue = malloc(sizeof(int) * width * height);
+	return landmarks;
+}
+
+/**
+ * \fn void destructLandmarks(Landmarks** landmarks)
+ * \brief function used to free the landmarks of a field
+ *
+ * \param landmarks : a double pointer to the landmarks to free
+ * \return void
+ */
+void destructLandmarks(Landmarks** landmarks)
+{
+	if(landmarks != NULL)
+	{
+		if(*landmarks != NULL)
+		{
+			if(activeLandmarks == *landmarks)
+			{
+				activeLandmarks = NULL;
+			}
+			free((*landmarks)->blocked);
+			free((*landmarks)->distance);
+			free((*landmarks)->queue);
+			free(*landmarks);
+			*landmarks = NULL;
+		}
+	}
+}
+
+/**
+ * \fn static void computeLandmarkDistances(Landmarks* landmarks, int landmark, int landmarkTile)
+ * \brief function which computes the distance of each tile to a landmark with a breadth first search
+ * through the tiles which are not WALLs
+ *
+ * \param landmarks : the landmarks, whose blocked tiles are set
+ * \param landmark : the number of the landmark
+ * \param landmarkTile : the index of the tile of the landmark
+ * \return void
+ */
+static void computeLandmarkDistances(Landmarks* landmarks, int landmark, int landmarkTile)
+{
+	int width = landmarks->width;
+	int nbTiles = width * landmarks->height;
+	int* distance = landmarks->distance;
+	int first = 0;
+	int last = 0;
+	int tile;
+	for(tile = 0; tile < nbTiles; tile++)
+	{
+		distance[tile * NB_LANDMARKS + landmark] = INFINITE_DISTANCE;
+	}
+	distance[landmarkTile * NB_LANDMARKS + landmark] = 0;
+	landmarks->queue[last++] = landmarkTile;
+
+	while(first < last)
+	{
+		int currentTile = landmarks->queue[first++];
+		int x = currentTile % width;
+		int neighbors[4];
+		int nbNeighbors = 0;
+		if(x > 0)
+		{
+			neighbors[nbNeighbors++] = currentTile - 1;
+		}
+		if(x < width - 1)
+		{
+			neighbors[nbNeighbors++] = currentTile + 1;
+		}
+		if(currentTile >= width)
+		{
+			neighbors[nbNeighbors++] = currentTile - width;
+		}
+		if(currentTile < nbTiles - width)
+		{
+			neighbors[nbNeighbors++] = currentTile + width;
+		}
+
+		int neighbor;
+		for(neighbor = 0; neighbor < nbNeighbors; neighbor++)
+		{
+			tile = neighbors[neighbor];
+			if(!landmarks->blocked[tile] && distance[tile * NB_LANDMARKS + landmark] == INFINITE_DISTANCE)
+			{
+				distance[tile * NB_LANDMARKS + landmark] = distance[currentTile * NB_LANDMARKS + landmark] + 1;
+				landmarks->queue[last++] = tile;
+			}
+		}
+	}
+}
+
+/**
+ * \fn static int getFarthestTileLandmarks(Landmarks* landmarks)
+ * \brief function which returns the tile which is not a WALL the farthest from its nearest landmark.
+ * The tiles which can't be reached from any landmark are the farthest ones
+ *
+ * \param landmarks : the landmarks, with at least one landmark
+ * \return int : the index of the tile, -1 if all the tiles which are not WALLs are landmarks
+ */
+static int getFarthestTileLandmarks(Landmarks* landmarks)
+{
+	int nbTiles = landmarks->width * landmarks->height;
+	int farthestTile = -1;
+	int farthestDistance = 0;
+	int tile;
+	for(tile = 0; tile < nbTiles; tile++)
+	{
+		if(!landmarks->blocked[tile])
+		{
+			int nearestDistance = INFINITE_DISTANCE;
+			int landmark;
+			for(landmark = 0; landmark < landmarks->nbLandmarks; landmark++)
+			{
+				if(landmarks->distance[tile * NB_LANDMARKS + landmark] < nearestDistance)
+				{
+					nearestDistance = landmarks->distance[tile * NB_LANDMARKS + landmark];
+				}
+			}
+			if(nearestDistance > farthestDistance)
+			{
+				farthestTile = tile;
+				farthestDistance = nearestDistance;
+			}
+		}
+	}
+	return farthestTile;
+}
+
+/**
+ * \fn void setMapLandmarks(Landmarks* landmarks, const Field* map)
+ * \brief function that chooses the landmarks of a field and computes the distances of its tiles to them,
+ * if the field or its WALLs changed since the last time
+ * The landmarks are chosen one after the other as far as possible from the previous ones
+ *
+ * \param landmarks : the landmarks
+ * \param map : the field, of the dimension of the landmarks
+ * \return void
+ */
+void setMapLandmarks(Landmarks* landmarks, const Field* map)
+{
+	if(landmarks->map == map && landmarks->isValid)
+	{
+		return;
+	}
+	landmarks->map = map;
+	landmarks->isValid = true;
+	landmarks->nbLandmarks = 0;
+
+	int firstTile = -1;
+	int x, y;
+	for(y = 0; y < landmarks->height; y++)
+	{
+		for(x = 0; x < landmarks->width; x++)
+		{
+			int tile = y * landmarks->width + x;
+			landmarks->blocked[tile] = getFieldTile(map, x, y) == WALL;
+			if(firstTile == -1 && !landmarks->blocked[tile])
+			{
+				firstTile = tile;
+			}
+		}
+	}
+	if(firstTile == -1)
+	{
+		//There is only WALLs, the manhattan distance is used
+		return;
+	}
+
+	//The first landmark is the tile the farthest from the first tile which is not a WALL
+	computeLandmarkDistances(landmarks, 0, firstTile);
+	landmarks->nbLandmarks = 1;
+	int landmarkTile = getFarthestTileLandmarks(landmarks);
+	landmarks->nbLandmarks = 0;
+	while(landmarkTile != -1 && landmarks->nbLandmarks < NB_LANDMARKS)
+	{
+		computeLandmarkDistances(landmarks, landmarks->nbLandmarks, landmarkTile);
+		landmarks->nbLandmarks++;
+		//The next landmark is the tile the farthest from the landmarks already chosen
+		landmarkTile = getFarthestTileLandmarks(landmarks);
+	}
+}
+
+/**
+ * \fn void updateTileLandmarks(Landmarks* landmarks, int x, int y)
+ * \brief function that tells the landmarks that a tile of their field has changed
+ * If a WALL has been added or removed, the landmarks are not used until setMapLandmarks computes them again
+ *
+ * \param landmarks : the landmarks
+ * \param x, y : the coordinate of the tile which changed
+ * \return void
+ */
+void updateTileLandmarks(Landmarks* landmarks, int x, int y)
+{
+	if(landmarks != NULL && landmarks->map != NULL &&
+	   landmarks->blocked[y * landmarks->width + x] != (getFieldTile(landmarks->map, x, y) == WALL))
+	{
+		landmarks->isValid = false;
+	}
+}
+
+/**
+ * \fn void useLandmarks(const Landmarks* landmarks)
+ * \brief function that gives the landmarks used by LANDMARK_HEURISTIC. The paths must then be searched
+ * on their field, or on a field where a path can't go through more tiles
+ *
+ * \param landmarks : the landmarks, NULL to use none
+ * \return void
+ */
+void useLandmarks(const Landmarks* landmarks)
+{
+	activeLandmarks = landmarks;
+}
+
+/**
+ * \fn NearestIndex* initNearestIndex(int width, int height)
+ * \brief function that initialise an index of the nearest walkable tiles without field for the fields of the given dimension
+ *
+ * \param width, height : the dimension of the fields of the index
+ * \return NearestIndex*
+ */
+NearestIndex* initNearestIndex(int width, int height)
+{
+	NearestIndex* index = malloc(sizeof(NearestIndex));
+	index->width = width;
+	index->height = height;
+	index->map = NULL;
+	index->isValid = false;
+	index->walkable = malloc(sizeof(bool) * width * height);
+	index->nearest = malloc(sizeof(int) * width * height);
+	index->distance = malloc(sizeof(int) * width * height);
+	index->queue = malloc(sizeof(int) * width * height);
+	index->previousInRow = malloc(sizeof(int) * width * height);
+	index->previousInColumn = malloc(sizeof(int) * width * height);
+	return index;
+}
+
+/**
+ * \fn void destructNearestIndex(NearestIndex** index)
+ * \brief function used to free an index of the nearest walkable tiles
+ *
+ * \param index : a double pointer to the index to free
+ * \return void
+ */
+void destructNearestIndex(NearestIndex** index)
+{
+	if(index != NULL)
+	{
+		if(*index != NULL)
+		{
+			free((*index)->walkable);
+			free((*index)->nearest);
+			free((*index)->distance);
+			free((*index)->queue);
+			free((*index)->previousInRow);
+			free((*index)->previousInColumn);
+			free(*index);
+			*index = NULL;
+		}
+	}
+}
+
+/**
+ * \fn static bool isBeforeNearest(int x1, int y1, int x2, int y2)
+ * \brief function which check if a walkable tile is chosen before another one in the same square by nearestNode
+ *
+ * \param x1, y1 : the coordinate of the first tile
+ * \param x2, y2 : the coordinate of the second tile
+ * \return bool
+ */
+static bool isBeforeNearest(int x1, int y1, int x2, int y2)
+{
+	return x1 > x2 || (x1 == x2 && y1 > y2);
+}
+
+/**
+ * \fn static int getNearestInSquare(NearestIndex* index, int x, int y, int size)
+ * \brief function which returns the walkable tile chosen by nearestNode on the border of the square of the given size around a tile,
+ * knowing that there is no walkable tile inside the square
+ *
+ * \param index : the index, whose walkable tiles and previous walkable tiles of the rows and columns are set
+ * \param x, y : the coordinate of the tile
+ * \param size : the size of the square, the distance of the nearest walkable tile
+ * \return int : the index of the walkable tile, -1 if there is none
+ */
+static int getNearestInSquare(NearestIndex* index, int x, int y, int size)
+{
+	int width = index->width;
+	int height = index->height;
+	int xMin = x - size;
+	int xMax = x + size;
+	int yMin = y - size;
+	int yMax = y + size;
+	int xBest = -1;
+	int yBest = -1;
+	if(xMin < 0)
+	{
+		xMin = 0;
+	}
+	if(yMin < 0)
+	{
+		yMin = 0;
+	}
+	if(yMax > height - 1)
+	{
+		yMax = height - 1;
+	}
+	//The right side of the square has the greatest x, we take its greatest y
+	if(x + size < width)
+	{
+		int yColumn = index->previousInColumn[yMax * width + x + size];
+		if(yColumn >= yMin)
+		{
+			return yColumn * width + x + size;
+		}
+	}
+	if(xMax > width - 1)
+	{
+		xMax = width - 1;
+	}
+	//Otherwise we take the greatest x of the bottom and top sides of the square
+	if(y + size < height)
+	{
+		int xRow = index->previousInRow[(y + size) * width + xMax];
+		if(xRow >= xMin)
+		{
+			xBest = xRow;
+			yBest = y + size;
+		}
+	}
+	if(y - size >= 0)
+	{
+		int xRow = index->previousInRow[(y - size) * width + xMax];
+		if(xRow >= xMin && isBeforeNearest(xRow, y - size, xBest, yBest))
+		{
+			xBest = xRow;
+			yBest = y - size;
+		}
+	}
+	//The left side of the square has the lowest x, but its tiles between the corners can have a greater y
+	if(x - size >= 0 && size > 0)
+	{
+		int yColumnMin = y - size + 1;
+		int yColumnMax = y + size - 1;
+		if(yColumnMin < 0)
+		{
+			yColumnMin = 0;
+		}
+		if(yColumnMax > height - 1)
+		{
+			yColumnMax = height - 1;
+		}
+		if(yColumnMin <= yColumnMax)
+		{
+			int yColumn = index->previousInColumn[yColumnMax * width + x - size];
+			if(yColumn >= yColumnMin && isBeforeNearest(x - size, yColumn, xBest, yBest))
+			{
+				xBest = x - size;
+				yBest = yColumn;
+			}
+		}
+	}
+	if(xBest == -1)
+	{
+		return -1;
+	}
+	return yBest * width + xBest;
+}
+
+/**
+ * \fn static void computeNearestIndex(NearestIndex* index)
+ * \brief function which computes the nearest walkable tile of each tile of the field of an index.
+ * The sizes of the squares are the distances of a breadth first search from all the walkable tiles at once,
+ * with diagonal steps, and the tile chosen in each square is read from the previous walkable tiles of the rows and columns
+ *
+ * \param index : the index, with a field
+ * \return void
+ */
+static void computeNearestIndex(NearestIndex* index)
+{
+	int width = index->width;
+	int height = index->height;
+	int first = 0;
+	int last = 0;
+	int x, y;
+	for(y = 0; y < height; y++)
+	{
+		for(x = 0; x < width; x++)
+		{
+			int tile = y * width + x;
+			index->walkable[tile] = isWalkableTile(index->map, x, y);
+			index->distance[tile] = INFINITE_DISTANCE;
+			index->nearest[tile] = -1;
+			if(index->walkable[tile])
+			{
+				index->distance[tile] = 0;
+				index->queue[last++] = tile;
+			}
+			//The previous walkable tiles of the rows and columns are filled in the order of the tiles
+			index->previousInRow[tile] = -1;
+			index->previousInColumn[tile] = -1;
+			if(index->walkable[tile])
+			{
+				index->previousInRow[tile] = x;
+				index->previousInColumn[tile] = y;
+			}
+			else
+			{
+				if(x > 0)
+				{
+					index->previousInRow[tile] = index->previousInRow[tile - 1];
+				}
+				if(y > 0)
+				{
+					index->previousInColumn[tile] = index->previousInColumn[tile - width];
+				}
+			}
+		}
+	}
+
+	//With diagonal steps, the number of steps between two tiles is the size of the smallest square around one containing the other
+	while(first < last)
+	{
+		int currentTile = index->queue[first++];
+		int xCurrent = currentTile % width;
+		int yCurrent = currentTile / width;
+		int dx, dy;
+		for(dy = -1; dy <= 1; dy++)
+		{
+			for(dx = -1; dx <= 1; dx++)
+			{
+				x = xCurrent + dx;
+				y = yCurrent + dy;
+				if(x >= 0 && x < width && y >= 0 && y < height && index->distance[y * width + x] == INFINITE_DISTANCE)
+				{
+					index->distance[y * width + x] = index->distance[currentTile] + 1;
+					index->queue[last++] = y * width + x;
+				}
+			}
+		}
+	}
+
+	for(y = 0; y < height; y++)
+	{
+		for(x = 0; x < width; x++)
+		{
+			int tile = y * width + x;
+			if(index->distance[tile] != INFINITE_DISTANCE)
+			{
+				index->nearest[tile] = getNearestInSquare(index, x, y, index->distance[tile]);
+			}
+		}
+	}
+}
+
+/**
+ * \fn void setMapNearestIndex(NearestIndex* index, const Field* map)
+ * \brief function that computes the nearest walkable tile of each tile of a field,
+ * if the field changed or one of its walkable tiles has been removed since the last time
+ *
+ * \param index : the index
+ * \param map : the field, of the dimension of the index
+ * \return void
+ */
+void setMapNearestIndex(NearestIndex* index, const Field* map)
+{
+	if(index->map == map && index->isValid)
+	{
+		return;
+	}
+	index->map = map;
+	index->isValid = true;
+	computeNearestIndex(index);
+}
+
+/**
+ * \fn void updateTileNearestIndex(NearestIndex* index, int x, int y)
+ * \brief function that tells an index that a tile of its field has changed. If the tile became walkable,
+ * the tiles for which it is now the nearest are updated around it. If it is not walkable anymore,
+ * the index is computed again by the next call to setMapNearestIndex
+ *
+ * \param index : the index
+ * \param x, y : the coordinate of the tile which changed
+ * \return void
+ */
+void updateTileNearestIndex(NearestIndex* index, int x, int y)
+{
+	if(index == NULL || index->map == NULL || !index->isValid)
+	{
+		return;
+	}
+	int width = index->width;
+	int tile = y * width + x;
+	bool isWalkable = isWalkableTile(index->map, x, y);
+	if(isWalkable == index->walkable[tile])
+	{
+		return;
+	}
+	index->walkable[tile] = isWalkable;
+	if(!isWalkable)
+	{
+		//The tiles whose nearest walkable tile was this one can be far away, everything is computed again
+		index->isValid = false;
+		return;
+	}
+
+	//We go through the borders of growing squares around the new walkable tile, and stop at the first one
+	//where every tile has a nearer walkable tile : the tiles of the next squares can't be nearer to it
+	int size = 0;
+	bool isUpdated = true;
+	while(isUpdated)
+	{
+		isUpdated = false;
+		int yMin = y - size;
+		int yMax = y + size;
+		if(yMin < 0)
+		{
+			yMin = 0;
+		}
+		if(yMax > index->height - 1)
+		{
+			yMax = index->height - 1;
+		}
+		int yBorder;
+		for(yBorder = yMin; yBorder <= yMax; yBorder++)
+		{
+			int xStep = 2 * size;
+			if(yBorder == y - size || yBorder == y + size || size == 0)
+			{
+				xStep = 1;
+			}
+			int xBorder;
+			for(xBorder = x - size; xBorder <= x + size; xBorder += xStep)
+			{
+				if(xBorder >= 0 && xBorder < width)
+				{
+					int borderTile = yBorder * width + xBorder;
+					int nearest = index->nearest[borderTile];
+					if(index->distance[borderTile] >= size)
+					{
+						isUpdated = true;
+						if(index->distance[borderTile] > size || isBeforeNearest(x, y, nearest % width, nearest / width))
+						{
+							index->distance[borderTile] = size;
+							index->nearest[borderTile] = tile;
+						}
+					}
+				}
+			}
+		}
+		size++;
+	}
+}
+
+/**
+ * \fn node* findNearestNodeIndex(NearestIndex* index, const Field* map, int x, int y)
+ * \brief function that returns the same node as nearestNode, read from an index in O(1) when the position is inside the field
+ *
+ * \param index : the index
+ * \param map : the field, of the dimension of the index
+ * \param x, y : the coordinates of the node used as a starting point for the pathfinding, which can be outside of the field
+ * \return node*
+ */
+node* findNearestNodeIndex(NearestIndex* index, const Field* map, int x, int y)
+{
+	int xNode = x;
+	int yNode = y;
+	if((x >= 0) && (x < map->width) && (y >= 0) && (y < map->height))
+	{
+		setMapNearestIndex(index, map);
+		int nearest = index->nearest[y * index->width + x];
+		if(nearest != -1)
+		{
+			xNode = nearest % index->width;
+			yNode = nearest / index->width;
+		}
+		return initNode(xNode, yNode, 0, 0);
+	}
+	//The squares around a position outside of the field are not the ones of a tile, they are searched
+	return nearestNode(map, x, y);
+}
+
+/**
+ * \fn static pathStatusEnum searchPath(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+ * \brief function that runs the A* algorithme until the end node is reached, no path is possible or the search is interrupted
+ * The path can then be read from the parents of the grid. With JPS_SEARCH, a jump point search is run instead,
+ * and with BIDIRECTIONAL_SEARCH, an A* search from both ends
+ * 
+ * \param startNode : the starting node of the A* algorithme
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \param grid : the grid used for the search, it is reset by this function
+ * \return pathStatusEnum : PATH_SEARCHING if the search was interrupted
+ */
+static pathStatusEnum searchPath(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+{
+	pathStatusEnum status = PATH_SEARCHING;
+	NodeHeap* openSet = NULL; //Used to store the openSet for the A* algorithm
+
+	if(searchMode == JPS_SEARCH)
+	{
+		return searchJumpPoints(startNode, endNode, theField, endEvent, grid);
+	}
+	if(searchMode == BIDIRECTIONAL_SEARCH)
+	{
+		return searchBidirectional(startNode, endNode, theField, endEvent, grid);
+	}
+	//We empty the sets of the previous search
+	resetSearchGrid(grid);
+	openSet = initNodeHeap(grid);
+	//We give to the openSet a starting point, which has no parent
+	pushNodeHeap(openSet, allocNodePool(grid->pool, startNode->x, startNode->y, startNode->cost, startNode->heuristic));
+	grid->parent[startNode->y * grid->width + startNode->x] = -1;
+	while (status == PATH_SEARCHING && (endEvent == NULL || *endEvent == false))
+	{
+		//We do one step of A* algorithme
+		status = stepAStar(openSet, endNode, theField);
+	}
+
+	//We free the openSet, and give back all the nodes of the search to the pool at once
+	destructNodeHeap(&openSet);
+	resetNodePool(grid->pool);
+
+	return status;
+}
+
+/**
+ * \fn findPathFromStartEnd(node* startNode, node* endNode, Field *theField, bool* endEvent)
+ * \brief function that finds the path between two points (start, end)
+ * returns the complete path. OtherWise return NULL. If no path possible, returns startNode
+ * 
+ * \param startNode : the starting node of the A* algorithme
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \return node*
+ */
+node* findPathFromStartEnd(node* startNode, node* endNode, Field *theField, bool* endEvent)
+{
+	SearchGrid* grid = getSharedSearchGrid(theField->width, theField->height);
+	pathStatusEnum status = searchPath(startNode, endNode, theField, endEvent, grid);
+
+	if(status == PATH_FOUND)
+	{
+		//We return the path we found
+		return getPathFromGrid(grid, endNode);
+	}
+	if(status == PATH_NOT_FOUND)
+	{
+		//We return just the starting node, which means their is no path
+		return startNode;
+	}
+	//The search has been interrupted
+	return NULL;
+}
+
+/**
+ * \fn pathStatusEnum findPathOnSearchGrid(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+ * \brief function that finds the path between two points (start, end) with the given grid instead of the shared one,
+ * so searches on different grids can be made at the same time by different threads.
+ * The path can then be read from the grid with getPathFromGrid or writePathFromGrid
+ * 
+ * \param startNode : the starting node of the A* algorithme
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \param grid : the grid used for the search, of the dimension of the field
+ * \return pathStatusEnum : PATH_SEARCHING if the search was interrupted
+ */
+pathStatusEnum findPathOnSearchGrid(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+{
+	return searchPath(startNode, endNode, theField, endEvent, grid);
+}
+
+/**
+ * \fn int findPathIntoBuffer(node* startNode, node* endNode, Field *theField, bool* endEvent, node* pathBuffer, int bufferSize)
+ * \brief function that finds the path between two points (start, end) and write it in a contiguous buffer
+ * instead of allocating each node (see writePathFromGrid)
+ * 
+ * \param startNode : the starting node of the A* algorithme
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \param pathBuffer : the buffer in which the path is written
+ * \param bufferSize : the number of nodes the buffer can hold
+ * \return int : the number of nodes of the path, 0 if no path was found.
+ * If it is greater than bufferSize, nothing is written
+ */
+int findPathIntoBuffer(node* startNode, node* endNode, Field *theField, bool* endEvent, node* pathBuffer, int bufferSize)
+{
+	SearchGrid* grid = getSharedSearchGrid(theField->width, theField->height);
+	if(searchPath(startNode, endNode, theField, endEvent, grid) != PATH_FOUND)
+	{
+		return 0;
+	}
+	return writePathFromGrid(grid, endNode, pathBuffer, bufferSize);
 }
 
@@ -14,8 +14,12 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
 #include <SDL2/SDL.h>
 #include "prototype.h"
+#include "bitGrid.h"
 
 //The structure node used in the A* algorithme (used in core.c)
 typedef struct node 
@@ -27,6 +31,137 @@ typedef struct node
 	struct node* linkedNode;
 }node;
 
+//The number of nodes allocated at once by a pool of nodes
+#define NODE_POOL_BLOCK_SIZE (1024)
+
+//The structure used to allocate the nodes of a search by blocks, and to free them all at once after the search
+typedef struct NodePool
+{
+	node** blocks; //The blocks of nodes already allocated, kept from one search to another
+	int nbBlocks;
+	int capacityBlocks;
+	int currentBlock; //The block from which the next node will be taken
+	int currentIndex; //The index of the next node in the current block
+	long nbNodesServed; //The number of nodes given by the pool since its creation
+}NodePool;
+
+//Enumeration of the states of an A* search after one step
+typedef enum {PATH_NOT_FOUND = -1, PATH_SEARCHING = 0, PATH_FOUND = 1} pathStatusEnum;
+
+//Enumeration of the ways an entity searches its paths
+//ASTAR_SEARCH : an A* search is made for each position the entity tries to go to
+//FLOOD_SEARCH : the field is flooded once from the entity, which then goes to the best position it can reach
+//JPS_SEARCH : a jump point search is made for each position the entity tries to go to
+//INCREMENTAL_SEARCH : the distances to the first position the entity tries to go to are kept from a decision
+//to the next one and only repaired where the mental map changed, the other positions use an A* search
+//HIERARCHICAL_SEARCH : the paths are searched between the entrances of square clusters of the mental map,
+//and the entity only goes to the first entrance of the path before its next decision
+//BIDIRECTIONAL_SEARCH : an A* search is made from both ends of each path at once until they meet,
+//for the entity and for the labeling on the complete field
+typedef enum {ASTAR_SEARCH = 0, FLOOD_SEARCH = 1, JPS_SEARCH = 2, INCREMENTAL_SEARCH = 3, HIERARCHICAL_SEARCH = 4, BIDIRECTIONAL_SEARCH = 5} searchModeEnum;
+
+#ifndef DEFAULT_SEARCH_MODE
+	#define DEFAULT_SEARCH_MODE ASTAR_SEARCH
+#endif
+
+//Enumeration of the heuristics of the A* algorithme, none of them is above the real number of steps to the end node,
+//so the paths found are shortest paths
+//MANHATTAN_HEURISTIC : the number of steps to the end node if there was no wall
+//OCTILE_HEURISTIC : the distance to the end node if diagonal steps were allowed, lower than the manhattan one
+//LANDMARK_HEURISTIC : the distances of the nodes to a few landmarks of the field, with the triangle inequality (ALT),
+//or the manhattan one if it is greater or if no landmarks are used (see useLandmarks)
+typedef enum {MANHATTAN_HEURISTIC = 0, OCTILE_HEURISTIC = 1, LANDMARK_HEURISTIC = 2} heuristicEnum;
+
+#ifndef DEFAULT_HEURISTIC
+	#define DEFAULT_HEURISTIC MANHATTAN_HEURISTIC
+#endif
+
+//The number of landmarks of a field used by LANDMARK_HEURISTIC
+#ifndef NB_LANDMARKS
+	#define NB_LANDMARKS (8)
+#endif
+
+//The structure used to know in O(1) which tiles are in the openSet or the closedSet of the A* algorithme
+//A tile is in a set only if its stamp is equal to the generation of the current search,
+//so the grid is reset between two searches by just incrementing the generation
+typedef struct SearchGrid
+{
+	int width;
+	int height;
+	uint32_t generation; //The number of the current search, never 0
+	uint32_t* openStamp; //For each tile of the field, the generation in which it is in the openSet
+	uint32_t* closedStamp; //For each tile of the field, the generation in which it is in the closedSet
+	int* position; //For each tile of the openSet, the index of its node in the heap
+	int* parent; //For each tile reached by the search, the index of the tile it was reached from (-1 for the start)
+	int* distance; //For each tile reached by a flood, its number of steps from the start
+	int* queue; //The tiles to visit during a flood
+	NodePool* pool; //The pool from which the nodes of the openSet and the closedSet are taken
+	struct SearchGrid* reverse; //The grid of the search from the end node of a bidirectional search, NULL until one is made
+}SearchGrid;
+
+//The distance of the tiles from which the goal of an incremental planner can't be reached
+#define INFINITE_DISTANCE INT_MAX
+
+//Structure of an incremental planner (Lifelong Planning A*, rooted on the goal) : it keeps the distance of each tile
+//to the goal, and only repairs the distances around the tiles which changed since the last path
+typedef struct IncrementalPlanner
+{
+	int width;
+	int height;
+	int xGoal, yGoal; //The goal of the planner, (-1, -1) if there is none
+	const Field* map; //The field on which the distances are computed
+	bool* walkable; //Whether a path could go through each tile when the planner last saw it
+	int* distance; //The distance of each tile to the goal, the g values of LPA*
+	int* lookahead; //The distance of each tile computed from its neighbors, the rhs values of LPA*
+	int* queue; //Binary min-heap of the tiles whose distance and lookahead differ
+	int* queuePosition; //The index of each tile in the queue, -1 if it is not in it
+	int queueSize;
+}IncrementalPlanner;
+
+//Structure of the landmarks of a field used by LANDMARK_HEURISTIC : the distance of each tile to each landmark.
+//The distances are computed as if the FOG was empty (a tile is walkable for the landmarks if it is not a WALL),
+//so they are never above the distances of the paths, which only go through EMPTY and VISITED tiles
+typedef struct Landmarks
+{
+	int width;
+	int height;
+	const Field* map; //The field on which the distances have been computed, NULL if there is none
+	bool isValid; //Whether the WALLs of the field are the same as when the distances have been computed
+	int nbLandmarks;
+	bool* blocked; //Whether each tile was a WALL when the distances have been computed
+	int* distance; //For each tile, its distance to each landmark one after the other (INFINITE_DISTANCE if it can't be reached)
+	int* queue; //The tiles to visit during the breadth first search of a landmark
+}Landmarks;
+
+//Structure of the index of the nearest walkable tile (EMPTY or VISITED) of each tile of a field, as nearestNode finds it :
+//the first walkable tile in growing squares around the tile, the one with the greatest x and then the greatest y in its square.
+//The start and end setups of wrapper.c keep calling nearestNode on their field : the start is the tile of the entity, which nearestNode
+//returns at once when it is walkable, and the end is outside of the field, where the index has no tile, so an index would not save any scan
+typedef struct NearestIndex
+{
+	int width;
+	int height;
+	const Field* map; //The field of the index, NULL if there is none
+	bool isValid; //Whether no walkable tile has been removed from the field since the index was computed
+	bool* walkable; //Whether each tile was walkable when the index last saw it
+	int* nearest; //The index of the nearest walkable tile of each tile, -1 if the field has none
+	int* distance; //The size of the square around each tile in which its nearest walkable tile is (INFINITE_DISTANCE if none)
+	int* queue; //The tiles to visit during the computation of the distances
+	int* previousInRow; //For each tile, the greatest x of a walkable tile of its row which is not after it, -1 if none
+	int* previousInColumn; //For each tile, the greatest y of a walkable tile of its column which is not after it, -1 if none
+}NearestIndex;
+
+//The structure used as the openSet of the A* algorithme : an indexed binary min-heap of nodes
+typedef struct NodeHeap
+{
+	node** nodes; //The nodes of the heap, ordered on their heuristic
+	int* order; //The insertion number of each node of the heap, used to break ties
+	int size;
+	int capacity;
+	int nbInsertion;
+	SearchGrid* grid; //The grid used to index the nodes of the heap and to know the closed tiles
+}NodeHeap;
+
 /**
  * \fn node* initNode(int x, int y, int cost, int heuristic)
  * \brief function that initialise a node. A node is a structure used in the A* algorithme
@@ -41,16 +176,66 @@ typedef struct node
 node* initNode(int x, int y, int cost, int heuristic);
 
 /**
- * \fn node* nearestNode(Field *oneField, int x, int y)
+ * \fn long getNbNodeAllocations(void)
+ * \brief function that returns the number of nodes allocated one by one with initNode since the start of the program
+ * The nodes taken from a pool of nodes are not counted
+ *
+ * \return long
+ */
+long getNbNodeAllocations(void);
+
+/**
+ * \fn NodePool* initNodePool(void)
+ * \brief function that initialise an empty pool of nodes
+ *
+ * \return NodePool*
+ */
+NodePool* initNodePool(void);
+
+/**
+ * \fn void destructNodePool(NodePool** pool)
+ * \brief function used to free a pool of nodes and all the nodes taken from it
+ *
+ * \param pool : a double pointer to the pool to free
+ * \return void
+ */
+void destructNodePool(NodePool** pool);
+
+/**
+ * \fn node* allocNodePool(NodePool* pool, int x, int y, int cost, int heuristic)
+ * \brief function that initialise a node taken from a pool of nodes. The node must not be freed on its own,
+ * it is given back to the pool when the pool is reset
+ *
+ * \param pool : the pool from which the node is taken
+ * \param x, y : the coordinate of the node
+ * \param cost : the number of step since the starting node
+ * \param heuristic : the cost + the distance between the ending node and the node initialized
+ * \return node*
+ */
+node* allocNodePool(NodePool* pool, int x, int y, int cost, int heuristic);
+
+/**
+ * \fn void resetNodePool(NodePool* pool)
+ * \brief function that gives back all the nodes taken from a pool at once, without freeing its blocks
+ *
+ * \param pool : the pool to reset
+ * \return void
+ */
+void resetNodePool(NodePool* pool);
+
+/**
+ * \fn node* nearestNode(const Field *oneField, int x, int y)
  * \brief function that return the nearest and safest node around the node which is used as a starting point for the pathfinding
  * But this node can be a WALL. A node is a structure used in the A* algorithme
  * A node can be used to create a chain list of node
+ * Only the border of each growing square around the node is read, and the search stops at the first square with a walkable tile.
+ * If the field has no tile a path can go through, the node is at the given coordinates
  *
  * \param x, y : the coordinates of the node used as a starting point for the pathfinding
  * \param oneField* : poiter to the field in which we search a safe node
  * \return node*
  */
-node* nearestNode(Field *oneField, int x, int y);
+node* nearestNode(const Field *oneField, int x, int y);
 
 /**
  * \fn void destructNodes(node** frontNode)
@@ -151,7 +336,8 @@ int nodeCmp(node* n1, node* n2);
 
 /**
  * \fn int distNodes(node* n1, node* n2)
- * \brief function which return the square of the distance between the two given nodes
+ * \brief function which return the distance between the two given nodes estimated with the heuristic chosen by setHeuristicMode
+ * The distance is never above the number of steps of a path between the two nodes
  * 
  * \param n1, n2 : the two nodes between which we want to know the distance
  * \return int
@@ -189,15 +375,40 @@ bool isNextTo(node* nodeToCheck, int x, int y);
 node* getLowestNode(node** openSet);
 
 /**
- * \fn node* getPath(node** closedSet, node* endNode)
- * \brief function which create a chain list of nodes which represent the obtimised path
- * using the closedSet of a A* algorithme
+ * \fn int getPathLengthFromGrid(SearchGrid* grid, int xEnd, int yEnd)
+ * \brief function which returns the number of nodes of the path found by a search, by following the parents
+ * from the end tile back to the start tile
+ * 
+ * \param grid : the grid of the search which reached the end tile
+ * \param xEnd, yEnd : the coordinate of the end tile
+ * \return int
+ */
+int getPathLengthFromGrid(SearchGrid* grid, int xEnd, int yEnd);
+
+/**
+ * \fn node* getPathFromGrid(SearchGrid* grid, node* endNode)
+ * \brief function which create a chain list of nodes which represent the path found by a search,
+ * using the parents recorded in its grid. Each node of the chain list is allocated
  * 
- * \param path : the chain list of nodes which represent the path of the A* algorithme
- * \param index : the node position of the node you want to return from the path
+ * \param grid : the grid of the search which reached the end node
+ * \param endNode : the end node of the A* algorithme
  * \return node*
  */
-node* getPath(node** closedSet, node* endNode);
+node* getPathFromGrid(SearchGrid* grid, node* endNode);
+
+/**
+ * \fn int writePathFromGrid(SearchGrid* grid, node* endNode, node* pathBuffer, int bufferSize)
+ * \brief function which write the path found by a search in a contiguous buffer, from the start to the end,
+ * using the parents recorded in its grid. The nodes of the buffer are linked to each other like a chain list,
+ * so the buffer can be read like a path but must not be freed node by node
+ * 
+ * \param grid : the grid of the search which reached the end node
+ * \param endNode : the end node of the A* algorithme
+ * \param pathBuffer : the buffer in which the path is written
+ * \param bufferSize : the number of nodes the buffer can hold
+ * \return int : the number of nodes of the path. If it is greater than bufferSize, nothing is written
+ */
+int writePathFromGrid(SearchGrid* grid, node* endNode, node* pathBuffer, int bufferSize);
 
 /**
  * \fn node* getNode(node** path, int index)
@@ -211,32 +422,425 @@ node* getPath(node** closedSet, node* endNode);
 node* getNode(node** path, int index);
 
 /**
- * \fn void addNeighbors(node** openSet, node** closedSet, node* currentNode, node* endNode, Field *theField)
+ * \fn SearchGrid* initSearchGrid(int width, int height)
+ * \brief function that initialise the membership grid of the A* algorithme for a field of the given dimension
+ *
+ * \param width, height : the dimension of the field on which the A* algorithme will be used
+ * \return SearchGrid*
+ */
+SearchGrid* initSearchGrid(int width, int height);
+
+/**
+ * \fn void destructSearchGrid(SearchGrid** grid)
+ * \brief function used to free a membership grid
+ *
+ * \param grid : a double pointer to the grid to free
+ * \return void
+ */
+void destructSearchGrid(SearchGrid** grid);
+
+/**
+ * \fn void resetSearchGrid(SearchGrid* grid)
+ * \brief function that empties the openSet and the closedSet of a grid in O(1), before a new search
+ *
+ * \param grid : the grid to reset
+ * \return void
+ */
+void resetSearchGrid(SearchGrid* grid);
+
+/**
+ * \fn SearchGrid* getSharedSearchGrid(int width, int height)
+ * \brief function that returns the grid shared by all the searches made on fields of the given dimension
+ * The grid is only allocated again when the dimension changes. It must only be used by one thread
+ *
+ * \param width, height : the dimension of the field on which the A* algorithme will be used
+ * \return SearchGrid*
+ */
+SearchGrid* getSharedSearchGrid(int width, int height);
+
+/**
+ * \fn bool isOpenSearchGrid(SearchGrid* grid, int x, int y)
+ * \brief function which check if the tile at the given coordinates is in the openSet of the current search
+ *
+ * \param grid : the grid of the current search
+ * \param x, y : the coordinate to check
+ * \return bool
+ */
+bool isOpenSearchGrid(SearchGrid* grid, int x, int y);
+
+/**
+ * \fn bool isClosedSearchGrid(SearchGrid* grid, int x, int y)
+ * \brief function which check if the tile at the given coordinates is in the closedSet of the current search
+ *
+ * \param grid : the grid of the current search
+ * \param x, y : the coordinate to check
+ * \return bool
+ */
+bool isClosedSearchGrid(SearchGrid* grid, int x, int y);
+
+/**
+ * \fn void closeSearchGrid(SearchGrid* grid, int x, int y)
+ * \brief function which add the tile at the given coordinates to the closedSet of the current search
+ *
+ * \param grid : the grid of the current search
+ * \param x, y : the coordinate of the tile
+ * \return void
+ */
+void closeSearchGrid(SearchGrid* grid, int x, int y);
+
+/**
+ * \fn void setSearchMode(searchModeEnum mode)
+ * \brief function that chooses the way the entities search their paths
+ *
+ * \param mode : the way the paths are searched
+ * \return void
+ */
+void setSearchMode(searchModeEnum mode);
+
+/**
+ * \fn searchModeEnum getSearchMode(void)
+ * \brief function that returns the way the entities search their paths
+ *
+ * \return searchModeEnum
+ */
+searchModeEnum getSearchMode(void);
+
+/**
+ * \fn bool setSearchModeFromName(const char* name)
+ * \brief function that chooses the way the entities search their paths from its name : "astar", "flood", "jps", "incremental", "hierarchical" or "bidirectional"
+ *
+ * \param name : the name of the way the paths are searched, can be NULL
+ * \return bool : false if the name is unknown, the way the paths are searched is then unchanged
+ */
+bool setSearchModeFromName(const char* name);
+
+/**
+ * \fn void setHeuristicMode(heuristicEnum heuristic)
+ * \brief function that chooses the heuristic of the A* algorithme and of the jump point search
+ *
+ * \param heuristic : the heuristic used by distNodes
+ * \return void
+ */
+void setHeuristicMode(heuristicEnum heuristic);
+
+/**
+ * \fn heuristicEnum getHeuristicMode(void)
+ * \brief function that returns the heuristic of the A* algorithme and of the jump point search
+ *
+ * \return heuristicEnum
+ */
+heuristicEnum getHeuristicMode(void);
+
+/**
+ * \fn bool setHeuristicModeFromName(const char* name)
+ * \brief function that chooses the heuristic of the A* algorithme from its name : "manhattan", "octile" or "landmark"
+ *
+ * \param name : the name of the heuristic, can be NULL
+ * \return bool : false if the name is unknown, the heuristic is then unchanged
+ */
+bool setHeuristicModeFromName(const char* name);
+
+/**
+ * \fn void floodSearchGrid(SearchGrid* grid, node* startNode, Field *theField)
+ * \brief function that goes through all the tiles which can be reached from a starting node with a breadth first search.
+ * Afterward, a tile is reached if it is in the closedSet of the grid, the distance and the parent of each reached tile are recorded,
+ * and the shortest path to any reached tile can be read with getPathFromGrid
+ *
+ * \param grid : the grid used for the flood, it is reset by this function
+ * \param startNode : the node from which the field is flooded
+ * \param theField* : pointer to the field used to see where the path can go
+ * \return void
+ */
+void floodSearchGrid(SearchGrid* grid, node* startNode, Field *theField);
+
+/**
+ * \fn bool isReachedSearchGrid(SearchGrid* grid, int x, int y)
+ * \brief function which check if the tile at the given coordinates has been reached by the last flood of a grid
+ *
+ * \param grid : the grid of the last flood
+ * \param x, y : the coordinate to check, which can be outside of the field
+ * \return bool
+ */
+bool isReachedSearchGrid(SearchGrid* grid, int x, int y);
+
+/**
+ * \fn bool isWalkableTile(const Field *theField, int x, int y)
+ * \brief function which check if a path can go through the tile at the given coordinates, like addNeighbor does
+ *
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param x, y : the coordinate to check, which can be outside of the field
+ * \return bool
+ */
+bool isWalkableTile(const Field *theField, int x, int y);
+
+/**
+ * \fn IncrementalPlanner* initIncrementalPlanner(int width, int height)
+ * \brief function that initialise an incremental planner without goal for the fields of the given dimension
+ *
+ * \param width, height : the dimension of the fields on which the planner will be used
+ * \return IncrementalPlanner*
+ */
+IncrementalPlanner* initIncrementalPlanner(int width, int height);
+
+/**
+ * \fn void destructIncrementalPlanner(IncrementalPlanner** planner)
+ * \brief function used to free an incremental planner
+ *
+ * \param planner : a double pointer to the planner to free
+ * \return void
+ */
+void destructIncrementalPlanner(IncrementalPlanner** planner);
+
+/**
+ * \fn void setGoalIncrementalPlanner(IncrementalPlanner* planner, const Field* map, int xGoal, int yGoal)
+ * \brief function that sets the goal of an incremental planner. If the goal or the field changed,
+ * all the distances are forgotten, otherwise they are kept
+ *
+ * \param planner : the incremental planner
+ * \param map : the field on which the distances are computed, of the dimension of the planner
+ * \param xGoal, yGoal : the coordinate of the goal
+ * \return void
+ */
+void setGoalIncrementalPlanner(IncrementalPlanner* planner, const Field* map, int xGoal, int yGoal);
+
+/**
+ * \fn void updateTileIncrementalPlanner(IncrementalPlanner* planner, int x, int y)
+ * \brief function that tells an incremental planner that a tile of its field has changed
+ * The distances are repaired the next time a path is asked
+ *
+ * \param planner : the incremental planner
+ * \param x, y : the coordinate of the tile which changed
+ * \return void
+ */
+void updateTileIncrementalPlanner(IncrementalPlanner* planner, int x, int y);
+
+/**
+ * \fn node* findPathFromIncrementalPlanner(IncrementalPlanner* planner, node* startNode)
+ * \brief function that repairs the distances of an incremental planner and returns a shortest path from a starting node to its goal
+ *
+ * \param planner : the incremental planner, with a goal
+ * \param startNode : the starting node of the path
+ * \return node* : the path, startNode if the goal can't be reached
+ */
+node* findPathFromIncrementalPlanner(IncrementalPlanner* planner, node* startNode);
+
+/**
+ * \fn Landmarks* initLandmarks(int width, int height)
+ * \brief function that initialise the landmarks of the fields of the given dimension, without any field
+ *
+ * \param width, height : the dimension of the fields
+ * \return Landmarks*
+ */
+Landmarks* initLandmarks(int width, int height);
+
+/**
+ * \fn void destructLandmarks(Landmarks** landmarks)
+ * \brief function used to free the landmarks of a field
+ *
+ * \param landmarks : a double pointer to the landmarks to free
+ * \return void
+ */
+void destructLandmarks(Landmarks** landmarks);
+
+/**
+ * \fn void setMapLandmarks(Landmarks* landmarks, const Field* map)
+ * \brief function that chooses the landmarks of a field and computes the distances of its tiles to them,
+ * if the field or its WALLs changed since the last time
+ * The landmarks are chosen one after the other as far as possible from the previous ones
+ *
+ * \param landmarks : the landmarks
+ * \param map : the field, of the dimension of the landmarks
+ * \return void
+ */
+void setMapLandmarks(Landmarks* landmarks, const Field* map);
+
+/**
+ * \fn void updateTileLandmarks(Landmarks* landmarks, int x, int y)
+ * \brief function that tells the landmarks that a tile of their field has changed
+ * If a WALL has been added or removed, the landmarks are not used until setMapLandmarks computes them again
+ *
+ * \param landmarks : the landmarks
+ * \param x, y : the coordinate of the tile which changed
+ * \return void
+ */
+void updateTileLandmarks(Landmarks* landmarks, int x, int y);
+
+/**
+ * \fn void useLandmarks(const Landmarks* landmarks)
+ * \brief function that gives the landmarks used by LANDMARK_HEURISTIC. The paths must then be searched
+ * on their field, or on a field where a path can't go through more tiles
+ *
+ * \param landmarks : the landmarks, NULL to use none
+ * \return void
+ */
+void useLandmarks(const Landmarks* landmarks);
+
+/**
+ * \fn NearestIndex* initNearestIndex(int width, int height)
+ * \brief function that initialise an index of the nearest walkable tiles without field for the fields of the given dimension
+ *
+ * \param width, height : the dimension of the fields of the index
+ * \return NearestIndex*
+ */
+NearestIndex* initNearestIndex(int width, int height);
+
+/**
+ * \fn void destructNearestIndex(NearestIndex** index)
+ * \brief function used to free an index of the nearest walkable tiles
+ *
+ * \param index : a double pointer to the index to free
+ * \return void
+ */
+void destructNearestIndex(NearestIndex** index);
+
+/**
+ * \fn void setMapNearestIndex(NearestIndex* index, const Field* map)
+ * \brief function that computes the nearest walkable tile of each tile of a field,
+ * if the field changed or one of its walkable tiles has been removed since the last time
+ *
+ * \param index : the index
+ * \param map : the field, of the dimension of the index
+ * \return void
+ */
+void setMapNearestIndex(NearestIndex* index, const Field* map);
+
+/**
+ * \fn void updateTileNearestIndex(NearestIndex* index, int x, int y)
+ * \brief function that tells an index that a tile of its field has changed. If the tile became walkable,
+ * the tiles for which it is now the nearest are updated around it. If it is not walkable anymore,
+ * the index is computed again by the next call to setMapNearestIndex
+ *
+ * \param index : the index
+ * \param x, y : the coordinate of the tile which changed
+ * \return void
+ */
+void updateTileNearestIndex(NearestIndex* index, int x, int y);
+
+/**
+ * \fn node* findNearestNodeIndex(NearestIndex* index, const Field* map, int x, int y)
+ * \brief function that returns the same node as nearestNode, read from an index in O(1) when the position is inside the field
+ *
+ * \param index : the index
+ * \param map : the field, of the dimension of the index
+ * \param x, y : the coordinates of the node used as a starting point for the pathfinding, which can be outside of the field
+ * \return node*
+ */
+node* findNearestNodeIndex(NearestIndex* index, const Field* map, int x, int y);
+
+/**
+ * \fn NodeHeap* initNodeHeap(SearchGrid* grid)
+ * \brief function that initialise an empty heap of nodes indexed on the given grid
+ * The heap is used as the openSet of the A* algorithme
+ *
+ * \param grid : the membership grid of the search, already reset
+ * \return NodeHeap*
+ */
+NodeHeap* initNodeHeap(SearchGrid* grid);
+
+/**
+ * \fn void destructNodeHeap(NodeHeap** heap)
+ * \brief function used to free a heap of nodes. The nodes it still contains belong to the pool of its grid
+ * and are not freed
+ *
+ * \param heap : a double pointer to the heap to free
+ * \return void
+ */
+void destructNodeHeap(NodeHeap** heap);
+
+/**
+ * \fn void pushNodeHeap(NodeHeap* heap, node* newNode)
+ * \brief function which add a node in the heap
+ * Between two nodes with the same heuristic, the last one pushed is the first one poped (like with a chain list)
+ *
+ * \param heap : the heap in which the node is added
+ * \param newNode : the node that you want to add
+ * \return void
+ */
+void pushNodeHeap(NodeHeap* heap, node* newNode);
+
+/**
+ * \fn node* popNodeHeap(NodeHeap* heap)
+ * \brief function which pop the node with the best heuristic (the lowest) out of the heap and returns it
+ *
+ * \param heap : the heap from which the node is poped
+ * \return node* : the poped node, NULL if the heap is empty
+ */
+node* popNodeHeap(NodeHeap* heap);
+
+/**
+ * \fn node* getNodeHeap(NodeHeap* heap, int x, int y)
+ * \brief function which returns the node of the heap at the given coordinates
+ *
+ * \param heap : the heap in which we search the node
+ * \param x, y : the coordinate to check
+ * \return node* : the node found, NULL if their is none
+ */
+node* getNodeHeap(NodeHeap* heap, int x, int y);
+
+/**
+ * \fn void decreaseNodeHeap(NodeHeap* heap, node* nodeToUpdate, int cost, node* endNode)
+ * \brief function which lower the cost of a node of the heap and move it up to its new place (decrease-key)
+ *
+ * \param heap : the heap which contains the node
+ * \param nodeToUpdate : the node to update, must be in the heap
+ * \param cost : the new cost of the node, must be lower than the actual one
+ * \param endNode : the end node of the A* algorithme, used to set the new heuristic
+ * \return void
+ */
+void decreaseNodeHeap(NodeHeap* heap, node* nodeToUpdate, int cost, node* endNode);
+
+/**
+ * \fn void addNeighbor(NodeHeap* openSet, node* currentNode, node* endNode, Field *theField, int x, int y)
+ * \brief function which adds or updates one neighbor of a given node in the openSet of the A* algorithme
+ * A neighbor already in the openSet is only updated if it is reached with a lower cost
+ * The closedSet is read from the grid of the openSet and the new nodes are taken from the pool of this grid
+ * 
+ * \param openSet : the heap of nodes which represent the openSet of the A* algorithme
+ * \param currentNode : the reference node used to create the neighbor
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : poiter to the field used to see if it is a valid neighbor or not
+ * \param x, y : the coordinate of the neighbor
+ * \return void
+ */
+void addNeighbor(NodeHeap* openSet, node* currentNode, node* endNode, Field *theField, int x, int y);
+
+/**
+ * \fn void addNeighbors(NodeHeap* openSet, node* currentNode, node* endNode, Field *theField)
  * \brief function which adds and create the neighboors of a given node in the openSet of the A* algorithme
- * It adds neighbors only if they are not in the closedSet or the openSet
+ * It adds neighbors only if they are not in the closedSet, and updates the ones already in the openSet
+ * The closedSet is read from the grid of the openSet
  * 
- * \param openSet : the chain list of nodes which represent the openSet of the A* algorithme
- * \param closedSet : the chain list of nodes which represent the closeSet of the A* algorithme
+ * \param openSet : the heap of nodes which represent the openSet of the A* algorithme
  * \param currentNode : the reference node used to create the neighbors
  * \param endNode : the end node of the A* algorithme
  * \param theField* : poiter to the field used to see if it is a valid neighbor or not
  * \return void
  */
-void addNeighbors(node** openSet, node** closedSet, node* currentNode, node* endNode, Field *theField);
+void addNeighbors(NodeHeap* openSet, node* currentNode, node* endNode, Field *theField);
+
+/**
+ * \fn pathStatusEnum stepAStar(NodeHeap* openSet, node* endNode, Field *theField)
+ * \brief function which do one step of the A* algorithme without building the path
+ * 
+ * \param openSet : the heap of nodes which represent the openSet of the A* algorithme, whose grid also keeps the closedSet
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer the field used to see where the path can go
+ * \return pathStatusEnum : PATH_FOUND once the end node is reached, PATH_NOT_FOUND if no path is possible
+ */
+pathStatusEnum stepAStar(NodeHeap* openSet, node* endNode, Field *theField);
 
 /**
- * \fn node* AStar(node** openSet, node** closedSet, node* startNode, node* endNode, Field *theField)
+ * \fn node* AStar(NodeHeap* openSet, node* startNode, node* endNode, Field *theField)
  * \brief function which do one step of the A* algorithme
  * once the path has been found, returns the complete path. OtherWise return NULL. If no path possible, returns startNode
  * 
- * \param openSet : the chain list of nodes which represent the openSet of the A* algorithme
- * \param closedSet : the chain list of nodes which represent the closeSet of the A* algorithme
+ * \param openSet : the heap of nodes which represent the openSet of the A* algorithme, whose grid also keeps the closedSet
  * \param startNode : the starting node of the A* algorithme
  * \param endNode : the end node of the A* algorithme
  * \param theField* : pointer the field used to see where the path can go
  * \return node*
  */
-node* AStar(node** openSet, node** closedSet, node* startNode, node* endNode, Field *theField);
+node* AStar(NodeHeap* openSet, node* startNode, node* endNode, Field *theField);
 
 /**
  * \fn findPathFromStartEnd(node* startNode, node* endNode, Field *theField, bool* endEvent)
@@ -251,4 +855,35 @@ node* AStar(node** openSet, node** closedSet, node* startNode, node* endNode, Fi
  */
 node* findPathFromStartEnd(node* startNode, node* endNode, Field *theField, bool* endEvent);
 
+/**
+ * \fn pathStatusEnum findPathOnSearchGrid(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid)
+ * \brief function that finds the path between two points (start, end) with the given grid instead of the shared one,
+ * so searches on different grids can be made at the same time by different threads.
+ * The path can then be read from the grid with getPathFromGrid or writePathFromGrid
+ * 
+ * \param startNode : the starting node of the A* algorithme
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \param grid : the grid used for the search, of the dimension of the field
+ * \return pathStatusEnum : PATH_SEARCHING if the search was interrupted
+ */
+pathStatusEnum findPathOnSearchGrid(node* startNode, node* endNode, Field *theField, bool* endEvent, SearchGrid* grid);
+
+/**
+ * \fn int findPathIntoBuffer(node* startNode, node* endNode, Field *theField, bool* endEvent, node* pathBuffer, int bufferSize)
+ * \brief function that finds the path between two points (start, end) and write it in a contiguous buffer
+ * instead of allocating each node (see writePathFromGrid)
+ * 
+ * \param startNode : the starting node of the A* algorithme
+ * \param endNode : the end node of the A* algorithme
+ * \param theField* : pointer to the field used to see where the path can go
+ * \param endEvent : pointer to boolean that will trigger the end of the function. Put NULL if there is none
+ * \param pathBuffer : the buffer in which the path is written
+ * \param bufferSize : the number of nodes the buffer can hold
+ * \return int : the number of nodes of the path, 0 if no path was found.
+ * If it is greater than bufferSize, nothing is written
+ */
+int findPathIntoBuffer(node* startNode, node* endNode, Field *theField, bool* endEvent, node* pathBuffer, int bufferSize);
+
 #endif
@@ -12,6 +12,9 @@
 #ifndef H_PROTOTYPE
     #define H_PROTOTYPE
 
+#include <stdint.h>
+#include <stdbool.h>
+
 #ifndef M_PI
 	#define M_PI 3.14159265358979323846
 #endif
@@ -20,14 +23,43 @@
     #define SAVING_PATH_STATS "../stats"
 #endif
 
+//Typedef of a tile of a field
+//A tile only holds a pointEnum value (from -1 to 3), so it is stored on a single byte.
+//Compile with -DFIELD_INT_TILES to store the tiles on an int instead
+#ifdef FIELD_INT_TILES
+    typedef int fieldTile;
+#else
+    typedef int8_t fieldTile;
+#endif
+
 //Typedef of field
+//The tiles are stored row by row in a single buffer : the tile (x, y) is at data[y*stride + x]
 typedef struct Field
 {
     int width;
     int height;
-    int** data;
+    int stride;
+    fieldTile* data;
 }Field;
 
+//Returns the value of the tile (x, y) of a field
+static inline int getFieldTile(const Field *oneField, int x, int y)
+{
+    return oneField->data[y*oneField->stride + x];
+}
+
+//Sets the value of the tile (x, y) of a field
+static inline void setFieldTile(Field *oneField, int x, int y, int value)
+{
+    oneField->data[y*oneField->stride + x] = (fieldTile)value;
+}
+
+//Returns a pointer to the first tile of the row y of a field
+static inline fieldTile *getFieldRow(Field *oneField, int y)
+{
+    return oneField->data + y*oneField->stride;
+}
+
 
 //Enumeration of what can be a point in the field
 typedef enum {UNDEFINED = -1, EMPTY = 0, WALL = 1, FOG = 2, VISITED = 3} pointEnum;
@@ -38,5 +70,52 @@ typedef enum {TRAIN_NN = 1, LOAD_NN = 2, TRAIN_GN = 3, LOAD_GN = 4, TRAIN_GN_EXP
 //Enumeration of the different weights for the labeling
 typedef enum {DIST = 0, NB_EMPTY = 1, NB_WALL = 2, NB_FOG = 3, NB_VISITED = 4, AVG_DIST_EMPTY = 5, AVG_DIST_WALL = 6, AVG_DIST_FOG = 7, AVG_DIST_VISITED = 8, DIST_FROM_ENTITY = 9} weightsEnum;
 
+//Typedef of a disk mask
+//Tells which tiles of a square of side 2*radius + 1 are strictly closer than radius to its center
+typedef struct DiskMask
+{
+    int radius;
+    int size;
+    bool* inside;
+}DiskMask;
+
+//Typedef of a table of lines of sight
+//For each tile of a square of side 2*radius + 1, the tiles a WALL on which hides it from the center of the square
+typedef struct LineOfSightTable
+{
+    int radius;
+    int size;
+    int* first; //The index of the first tile of the line of the tile (x, y) is first[y*size + x], the one after its last tile is first[y*size + x + 1]
+    int* xCells; //The tiles of all the lines one after the other
+    int* yCells;
+    int nbWords; //The number of 64 bits words of a mask of the square
+    uint64_t* blockers; //The tiles of the line of the tile (x, y) packed in the words [(y*size + x)*nbWords, (y*size + x + 1)*nbWords[, the tile (x', y') on the bit y'*size + x'
+}LineOfSightTable;
+
+//Typedef of a field view
+//A window of a map centered on a tile and limited to a disk mask. It doesn't own any tile :
+//the tiles outside of the disk or outside of the map read as UNDEFINED
+typedef struct FieldView
+{
+    const Field* map;
+    const DiskMask* mask;
+    int width;
+    int height;
+    int xOrigin;
+    int yOrigin;
+    int xMin, xMax;
+    int yMin, yMax;
+}FieldView;
+
+//Returns the value of the tile (x, y) of a field view
+static inline int getFieldViewTile(const FieldView *view, int x, int y)
+{
+    if(x < view->xMin || x > view->xMax || y < view->yMin || y > view->yMax || !view->mask->inside[y*view->mask->size + x])
+    {
+        return UNDEFINED;
+    }
+    return getFieldTile(view->map, view->xOrigin + x, view->yOrigin + y);
+}
+
 #endif
 
@@ -103,9 +103,6 @@ NeuralNetwork *trainingNN1(int visionRange, dataType *data, int fieldHeight, int
  */
 LabelingWeights *trainingGN1(dataType *data, Field* theField, char *savingPathGN, char* basePathGN, int nbGeneration, int nbMember)
 {
-    //Initialisation and generation of a field
-	InterestField* interestField = initialiseInterestField(theField->width, theField->height);
-	
 	//Creation of the first generation
 	GeneticNetworks* geneticNetworks = initialiseGeneticNetworksFrom(nbMember, basePathGN, 0.05);
 	if (geneticNetworks == NULL)
@@ -143,25 +140,22 @@ LabelingWeights *trainingGN1(dataType *data, Field* theField, char *savingPathGN
 		        updateFieldOfViewEntity(theField, entity);
 		        updateMentalMapEntity(entity, NULL);
 		        
-		        updateInterestField2(interestField, endNode->x, endNode->y, entity, geneticNetworks->list[networkIndex]);
+		        updateInterestField2(entity->interestField, endNode->x, endNode->y, entity, geneticNetworks->list[networkIndex]);
+		        rankInterestField(entity->interestRanking, entity->interestField);
 		
 		        //We set a default node to which the entity will try to move to
 		        node* wantedPosition = cpyNode(endNode);
-		        node* path = NULL;
 		        //We update the start node of the pathfinding
 		        startNode->x = entity->x;
 		        startNode->y = entity->y;
 		        //We search for a path based on the interest field
-		        while((path == startNode || path == NULL) && !data->endEvent)
+		        node* path = findPathToCandidates(entity, startNode, wantedPosition, &(data->endEvent));
+		        free(wantedPosition);
+		        //When no position can be reached, the entity stays where it is
+		        if(path == startNode)
 		        {
-			        destructNodes(&path);
-			        path = findPathFromStartEnd(startNode, wantedPosition, entity->mentalMap, &(data->endEvent));
-			        if ((path == startNode || path == NULL))
-			        {
-				        updateBestWantedPosition(wantedPosition, interestField);
-			        }
+		            path = cpyNode(startNode);
 		        }
-		        free(wantedPosition);
 		        
 		        geneticNetworks->score[networkIndex] += getNbNode(&path);
 		        moveEntityAlongPath(data, entity, path, theField, NULL, 0, 0, NULL);
@@ -180,7 +174,6 @@ LabelingWeights *trainingGN1(dataType *data, Field* theField, char *savingPathGN
 	    printf("\tbest : score : %.3f, time : %.3f\n", geneticNetworks->score[0], geneticNetworks->time[0]);
 	    
 	}
-    destructInterestField(&interestField);
     
 	LabelingWeights* labelingWeights = geneticNetworks->list[0];
 
@@ -225,9 +218,6 @@ LabelingWeights *trainingGN1(dataType *data, Field* theField, char *savingPathGN
  */
 LabelingWeights *trainingGN2(dataType *data, Field* theField, char *savingPathGN, char* basePathGN, int nbGeneration, int nbMember, float percentReveal)
 {
-    //Initialisation and generation of a field
-	InterestField* interestField = initialiseInterestField(theField->width, theField->height);
-	
 	//Creation of the first generation
 	GeneticNetworks* geneticNetworks = initialiseGeneticNetworksFrom(nbMember, basePathGN, 0.05);
 	if (geneticNetworks == NULL)
@@ -268,25 +258,22 @@ LabelingWeights *trainingGN2(dataType *data, Field* theField, char *savingPathGN
 		        updateFieldOfViewEntity(theField, entity);
 		        updateMentalMapEntity(entity, NULL);
 		        
-		        updateInterestField3(interestField, entity, geneticNetworks->list[networkIndex]);
+		        updateInterestField3(entity->interestField, entity, geneticNetworks->list[networkIndex]);
+		        rankInterestField(entity->interestRanking, entity->interestField);
 		
 		        //We set a default node to which the entity will try to move to
 		        node* wantedPosition = cpyNode(endNode);
-		        node* path = NULL;
 		        //We update the start node of the pathfinding
 		        startNode->x = entity->x;
 		        startNode->y = entity->y;
 		        //We search for a path based on the interest field
-		        while((path == startNode || path == NULL) && !data->endEvent)
+		        node* path = findPathToCandidates(entity, startNode, wantedPosition, &(data->endEvent));
+		        free(wantedPosition);
+		        //When no position can be reached, the entity stays where it is
+		        if(path == startNode)
 		        {
-			        destructNodes(&path);
-			        path = findPathFromStartEnd(startNode, wantedPosition, entity->mentalMap, &(data->endEvent));
-			        if ((path == startNode || path == NULL))
-			        {
-				        updateBestWantedPosition(wantedPosition, interestField);
-			        }
+		            path = cpyNode(startNode);
 		        }
-		        free(wantedPosition);
 		        
 		        remainingFog = getNbFog(entity->mentalMap);
 		        geneticNetworks->score[networkIndex] += getNbNode(&path);
@@ -306,7 +293,6 @@ LabelingWeights *trainingGN2(dataType *data, Field* theField, char *savingPathGN
 	    printf("\tbest : score : %.3f, time : %.3f\n", geneticNetworks->score[0], geneticNetworks->time[0]);
 	    
 	}
-    destructInterestField(&interestField);
     
 	LabelingWeights* labelingWeights = geneticNetworks->list[0];
 
@@ -474,6 +460,8 @@ void trainNN2onField(NeuralNetwork *neuralNetwork, dataType *data, Field* field,
 	entity->y = startNode->y;
 	destructNodes(&startNode);
 	node* endNode = nearestNode(field, field->width, field->height);
+	//The field doesn't change during the training, so the key of its distances is only computed once
+	uint64_t fieldKey = getFieldKey(field);
 
 	//While the entity hasn't arrived
 	while ((entity->x != endNode->x || entity->y != endNode->y) && !data->endEvent)
@@ -487,7 +475,7 @@ void trainNN2onField(NeuralNetwork *neuralNetwork, dataType *data, Field* field,
 		float *output = getOutputOfNeuralNetwork(neuralNetwork, input);
 		node *choice = findNextPathNN2(entity, data, output);
 		//Find the expected choice
-		node *expectedNode = labeling2(entity, endNode->x, endNode->y, field, data);
+		node *expectedNode = labeling2(entity, endNode->x, endNode->y, field, fieldKey);
 		float *expectedOutput = convertLabeling2(field->width, field->height, expectedNode);
 		node *expectedPath = findNextPathNN2(entity, data, expectedOutput);
 